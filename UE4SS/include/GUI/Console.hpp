@@ -1,6 +1,8 @@
 #pragma once
 
-#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -14,31 +16,66 @@ namespace RC::GUI
 {
     class Console
     {
+      private:
+        struct ConsoleLine
+        {
+            std::string text{};
+            Color::Color color{};
+        };
+
+        // Slot in the ring buffer that lines are written to from any thread, only the render thread reads from it
+        // The lock is only ever contended by one writer & the render thread, and only when they land on the same slot
+        // Lines stay in their slot after they've been added to the text editor, the ring buffer doubles as the history the editor is refilled from
+        struct PendingLineSlot
+        {
+            std::atomic_flag is_locked{};
+            // One past the write position of the line in this slot, a newer lap has overwritten the line if this is higher than expected
+            uint64_t written_position{};
+            ConsoleLine line{};
+        };
+
+        enum class ReadLineResult
+        {
+            Read,
+            NotWrittenYet,
+            Overwritten,
+        };
+
       private:
         char m_input_buffer[256]{};
-        std::vector<std::string> m_lines{};
         ImGuiTextFilter m_filter{};
         float m_previous_max_scroll_y{};
         float m_current_console_output_width{};
-        std::mutex m_lines_mutex{};
-        TextEditor m_text_editor{};
+        // The editor that's shown
+        std::unique_ptr<TextEditor> m_text_editor{};
+        // Refilled with the newest lines a few at a time once 'm_text_editor' is full, and shown in its place once it has caught up
+        // The text editor can only be cleared as a whole, so this is how the oldest lines are evicted without a long frame
+        std::unique_ptr<TextEditor> m_next_text_editor{};
+        uint64_t m_next_text_editor_read_position{};
         TextEditor::Breakpoints m_breakpoints{};
         const size_t m_maximum_num_lines{50000};
+        // Lines added to 'm_next_text_editor' per frame, on top of the lines that were logged that frame
+        const size_t m_num_lines_to_refill_per_frame{2000};
+        std::unique_ptr<PendingLineSlot[]> m_pending_lines{};
+        std::atomic<uint64_t> m_next_write_position{};
+        uint64_t m_next_read_position{};
 
       public:
         Console()
         {
-            m_text_editor.SetConsoleMode(true);
-            m_text_editor.SetColorizerEnable(false);
-            m_text_editor.SetLanguageDefinition(GetLanguageDefinitionNone());
-            m_text_editor.SetPalette(GetPalette());
-            m_text_editor.SetBreakpoints(m_breakpoints);
-            m_text_editor.SetTextFilter(&m_filter);
+            m_pending_lines = std::make_unique<PendingLineSlot[]>(m_maximum_num_lines);
+            m_text_editor = make_text_editor();
         }
 
       private:
         auto GetLanguageDefinitionNone() -> const TextEditor::LanguageDefinition&;
         auto GetPalette() const -> const TextEditor::Palette&;
+        auto make_text_editor() -> std::unique_ptr<TextEditor>;
+        auto push_pending_line(std::string&& line, Color::Color color) -> void;
+        auto read_pending_line(uint64_t position, ConsoleLine& out_line) -> ReadLineResult;
+        // Adds lines written since the last frame to the text editor, must only be called from the render thread
+        auto drain_pending_lines() -> void;
+        auto add_line_to_text_editor(TextEditor& text_editor, const ConsoleLine& line) -> void;
 
       public:
         auto render() -> void;
@@ -128,7 +128,7 @@ namespace RC::GUI
         static size_t s_currently_selected_object_index;
         static std::unordered_map<UObject*, std::vector<size_t>> s_history_object_to_index;
         static std::vector<UObject*> s_name_search_results;
-        static std::unordered_set<UObject*> s_name_search_results_set;
+        static std::unordered_map<UObject*, size_t> s_name_search_result_indices;
         static std::string s_name_to_search_by;
         static std::vector<std::unique_ptr<Watch>> s_watches;
         static std::unordered_map<WatchIdentifier, Watch*> s_watch_map;
@@ -6,9 +6,11 @@
 #include <deque>
 #include <filesystem>
 #include <functional>
+#include <map>
 #include <mutex>
 #include <set>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -84,6 +86,7 @@ namespace RC::GUI
     struct LuaBreakpoint
     {
         std::string source_file; // Source file path
+        std::string chunk_name; // 'source_file' normalized for matching against loaded chunks
         int line{0};
         bool enabled{true};
         std::string condition; // Optional condition expression
@@ -158,7 +161,13 @@ namespace RC::GUI
 
         // Breakpoints
         std::vector<LuaBreakpoint> m_breakpoints;
+        // Enabled breakpoint lines by chunk name, rebuilt whenever 'm_breakpoints' changes
+        std::unordered_map<std::string, std::set<int>> m_breakpoint_index;
         mutable std::mutex m_breakpoints_mutex;
+        // Breakpoints currently patched into the bytecode of each Lua state, by main thread & chunk name
+        // Maps the line that was patched to the line that was requested, lua_breakpoint moves breakpoints on lines without code
+        std::unordered_map<lua_State*, std::unordered_map<std::string, std::map<int, int>>> m_patched_breakpoints;
+        std::mutex m_patched_breakpoints_mutex;
         std::atomic<bool> m_is_paused{false};
         std::atomic<bool> m_step_requested{false};
         std::atomic<bool> m_step_over_requested{false};
@@ -170,6 +179,12 @@ namespace RC::GUI
         std::condition_variable m_pause_cv;
         std::mutex m_pause_mutex;
         int m_step_start_depth{0};
+        int m_step_start_line{0};
+        // Main thread of the state that has every line patched for an in-progress step
+        lua_State* m_stepping_state{nullptr};
+        // Main threads of states that still have step patches left over from an earlier step, guarded by 'm_patched_breakpoints_mutex'
+        // Each of them removes its own patches the next time it's interrupted
+        std::set<lua_State*> m_pending_step_cleanup;
 
         // Cached paused state info (captured on Lua thread, read on GUI thread)
         // IMPORTANT: Never manipulate the Lua state from the GUI thread while paused!
@@ -178,7 +193,7 @@ namespace RC::GUI
         std::vector<LuaStackFrame> m_paused_stack_frames; // Call stack with local variables
         mutable std::mutex m_paused_data_mutex;
 
-        // Track which states have debug hooks installed
+        // Main threads of the states that have debugging enabled, guarded by 'm_states_mutex'
         std::set<lua_State*> m_states_with_hooks;
 
         // Script viewer (for Debug view)
@@ -257,8 +272,11 @@ namespace RC::GUI
         auto step_over() -> void;
         auto step_out() -> void;
 
-        // Debug hook (called from Lua)
-        static auto debug_hook(lua_State* L, lua_Debug* ar) -> void;
+        // Debug callbacks (called from Luau)
+        // Breakpoints are patched into the bytecode, lines without a breakpoint run at full speed
+        static auto debug_break(lua_State* L, lua_Debug* ar) -> void;
+        static auto on_chunk_loaded(lua_State* L) -> void;
+        static auto on_interrupt(lua_State* L, int gc) -> void;
         auto install_debug_hook(lua_State* L) -> void;
         auto uninstall_debug_hook(lua_State* L) -> void;
         auto has_debug_hook(lua_State* L) const -> bool;
@@ -298,9 +316,15 @@ namespace RC::GUI
         auto find_mod_name_for_state(lua_State* L) const -> std::string;
         auto request_globals_refresh() -> void;
         auto request_loaded_modules_refresh() -> void;
-        auto check_breakpoint(lua_State* L, lua_Debug* ar) -> bool;
+        static auto normalize_chunk_name(std::string_view chunk_name) -> std::string;
+        auto rebuild_breakpoint_index() -> void;
+        auto request_breakpoint_sync() -> void;
+        auto sync_breakpoints(lua_State* L) -> void;
+        auto is_breakpoint_hit(lua_State* L, lua_Debug* ar) -> bool;
+        auto is_step_complete(lua_State* L, lua_Debug* ar) -> bool;
+        auto set_step_breakpoints(lua_State* L, bool enabled) -> void;
+        auto pause_execution(lua_State* L, lua_Debug* ar) -> void;
         auto wait_for_continue() -> void;
-        auto get_call_depth(lua_State* L) -> int;
 
         // Filter for globals view
         std::string m_globals_filter;
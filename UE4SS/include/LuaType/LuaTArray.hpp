@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string_view>
+
 #include <LuaType/LuaUObject.hpp>
 #pragma warning(disable : 4005)
 #include <Unreal/Core/Containers/ScriptArray.hpp>
@@ -49,5 +51,7 @@ namespace RC::LuaType
         auto static handle_unreal_property_value(
                 const LuaMadeSimple::Type::Operation, const LuaMadeSimple::Lua&, Unreal::FScriptArray*, int64_t array_index, const TArray& lua_object) -> void;
         auto static prepare_to_handle(const LuaMadeSimple::Type::Operation, const LuaMadeSimple::Lua&) -> void;
+        // Throws a Lua error unless the elements can be copied as raw memory
+        auto static verify_inner_is_plain_old_data(const LuaMadeSimple::Lua&, const TArray& lua_object, std::string_view function_name) -> void;
     };
 } // namespace RC::LuaType
@@ -66,10 +66,14 @@ namespace RC::LuaType
 
         Unreal::FScriptMapLayout layout{};
 
+        // Resolved by validate_pushers, never null afterwards.
+        StaticState::PropertyValuePusherCallable key_pusher{};
+        StaticState::PropertyValuePusherCallable value_pusher{};
+
         FScriptMapInfo(Unreal::FProperty* key, Unreal::FProperty* value);
 
         /**
-        * Validates existence of lua pushers for this key/values in this structure.
+        * Validates existence of lua pushers for this key/values in this structure, and stores them in key_pusher/value_pusher.
         * Throws if a pusher for a key/value was not found
         *
         * @param lua Lua state to throw against.
@@ -64,10 +64,13 @@ namespace RC::LuaType
         Unreal::FName element_fname{};
         Unreal::FScriptSetLayout layout{};
 
+        // Resolved by validate_pushers, never null afterwards.
+        StaticState::PropertyValuePusherCallable element_pusher{};
+
         FScriptSetInfo(Unreal::FProperty* element);
 
         /**
-         * Validates existence of lua pushers for this element in this structure.
+         * Validates existence of lua pushers for this element in this structure, and stores it in element_pusher.
          * Throws if a pusher for the element was not found
          *
          * @param lua Lua state to throw against.
@@ -4,6 +4,8 @@
 
 #include <format>
 #include <functional>
+#include <stdexcept>
+#include <vector>
 
 #include <Constructs/Generator.hpp>
 #include <DynamicOutput/DynamicOutput.hpp>
@@ -337,10 +339,119 @@ namespace RC::LuaType
         Unreal::UFunction* function;
     };
 
+    // Dispatch table from a property class (by the comparison index of its FName) to the function that pushes values of that type to/from Lua.
+    // Backed by an open-addressed array of plain function pointers instead of a node-based map,
+    // so a lookup is one multiplicative hash and, in practice, a single slot comparison.
+    // Registration is not thread-safe, pushers must be registered before any Lua state uses the table.
+    class PropertyValuePusherTable
+    {
+      public:
+        using Callable = void (*)(const PusherParams&);
+
+      private:
+        struct Slot
+        {
+            int32_t comparison_index{};
+            Callable pusher{};
+        };
+        // The capacity is always a power of two, and is kept at least twice the number of pushers so that probe chains stay short.
+        static constexpr size_t s_initial_capacity_bits = 8;
+        size_t m_capacity_bits{s_initial_capacity_bits};
+        std::vector<Slot> m_slots = std::vector<Slot>(size_t{1} << s_initial_capacity_bits);
+        size_t m_size{};
+
+        auto slot_for(int32_t comparison_index) const -> size_t
+        {
+            return (static_cast<uint32_t>(comparison_index) * 2654435769u) >> (32 - m_capacity_bits);
+        }
+
+        auto insert(int32_t comparison_index, Callable pusher) -> bool
+        {
+            for (size_t i = slot_for(comparison_index);; i = (i + 1) & (m_slots.size() - 1))
+            {
+                auto& slot = m_slots[i];
+                if (!slot.pusher)
+                {
+                    slot = {comparison_index, pusher};
+                    ++m_size;
+                    return true;
+                }
+                if (slot.comparison_index == comparison_index)
+                {
+                    return false;
+                }
+            }
+        }
+
+        auto grow() -> void
+        {
+            auto old_slots = std::move(m_slots);
+            ++m_capacity_bits;
+            m_slots = std::vector<Slot>(size_t{1} << m_capacity_bits);
+            m_size = 0;
+            for (const auto& slot : old_slots)
+            {
+                if (slot.pusher)
+                {
+                    insert(slot.comparison_index, slot.pusher);
+                }
+            }
+        }
+
+      public:
+        // Returns false if the pusher is null, or if a pusher was already registered for this property type.
+        auto emplace(int32_t comparison_index, Callable pusher) -> bool
+        {
+            if (!pusher)
+            {
+                return false;
+            }
+            if ((m_size + 1) * 2 > m_slots.size())
+            {
+                grow();
+            }
+            return insert(comparison_index, pusher);
+        }
+
+        // Returns nullptr if there's no pusher registered for this property type.
+        auto find(int32_t comparison_index) const -> Callable
+        {
+            for (size_t i = slot_for(comparison_index);; i = (i + 1) & (m_slots.size() - 1))
+            {
+                const auto& slot = m_slots[i];
+                if (!slot.pusher || slot.comparison_index == comparison_index)
+                {
+                    return slot.pusher;
+                }
+            }
+        }
+
+        auto contains(int32_t comparison_index) const -> bool
+        {
+            return find(comparison_index) != nullptr;
+        }
+
+        // Throws std::out_of_range if there's no pusher registered for this property type.
+        // Use 'find' in code that handles unsupported types itself.
+        auto operator[](int32_t comparison_index) const -> Callable
+        {
+            if (auto pusher = find(comparison_index))
+            {
+                return pusher;
+            }
+            throw std::out_of_range{fmt::format("No property value pusher registered for comparison index {}", comparison_index)};
+        }
+
+        auto size() const -> size_t
+        {
+            return m_size;
+        }
+    };
+
     struct StaticState
     {
-        using PropertyValuePusherCallable = std::function<void(const PusherParams&)>;
-        static inline std::unordered_map<int32_t, PropertyValuePusherCallable> m_property_value_pushers;
+        using PropertyValuePusherCallable = PropertyValuePusherTable::Callable;
+        static inline PropertyValuePusherTable m_property_value_pushers;
     };
 
     RC_UE4SS_API auto auto_construct_object(const LuaMadeSimple::Lua&, Unreal::UObject*) -> void;
@@ -396,8 +507,28 @@ namespace RC::LuaType
     RC_UE4SS_API auto push_functionproperty(const FunctionPusherParams&) -> void;
     // Push to Lua -> END
 
-    auto handle_unreal_property_value(
-            const Operation operation, const LuaMadeSimple::Lua&, Unreal::UObject* base, Unreal::FName property_name, Unreal::FField* field) -> void;
+    // Pass 'pusher' if it's already known for the type of 'field', otherwise it's looked up
+    auto handle_unreal_property_value(const Operation operation,
+                                      const LuaMadeSimple::Lua&,
+                                      Unreal::UObject* base,
+                                      Unreal::FName property_name,
+                                      Unreal::FField* field,
+                                      StaticState::PropertyValuePusherCallable pusher = nullptr) -> void;
+
+    struct MemberLookupResult
+    {
+        Unreal::FName property_name{};
+        // nullptr if no property was found, in which case the member might be a UFunction
+        Unreal::FField* field{};
+        // nullptr if 'field' is nullptr, is a UFunction, or has no registered handler
+        StaticState::PropertyValuePusherCallable pusher{};
+    };
+
+    // Resolves 'object.member_name' as accessed from Lua, including custom properties.
+    // Results are cached per thread, UStruct & member name, and invalidated when a cached UStruct is deleted or custom properties change.
+    auto find_member_for_lua(Unreal::UObject* object, std::string_view member_name) -> MemberLookupResult;
+    // Must be called whenever custom properties are added or removed.
+    RC_UE4SS_API auto clear_property_lookup_cache() -> void;
 
     auto is_a_implementation(const LuaMadeSimple::Lua& lua) -> int;
 
@@ -756,7 +887,10 @@ Overloads:
         {
             auto& lua_object = lua.get_userdata<SelfType>();
 
-            const StringType& member_name = ensure_str_const(lua.get_string());
+            // The key is left on the stack until we're done with it, 'member_name' is only valid for as long as the string is on the stack
+            size_t member_name_length{};
+            const char* member_name_data = lua_tolstring(lua.get_lua_state(), 1, &member_name_length);
+            const std::string_view member_name{member_name_data ? member_name_data : "", member_name_length};
 
             // If nullptr then we assume the UObject wasn't found so lets return an invalid UObject to Lua
             // This allows the safe chaining of "__index" as long as the Lua script checks ":IsValid()" before using the object
@@ -767,35 +901,26 @@ Overloads:
                 {
                 case Operation::Get:
                 case Operation::GetParam:
+                    lua.discard_value(1);
                     // Construct an empty object to allow for safe chaining with a validity check at the end
                     SelfType::construct(lua, static_cast<DerivedType*>(nullptr));
                     break;
                 case Operation::Set:
-                    Output::send(STR("[Lua][Error] Tried setting member variable '{}' but UObject instance is nullptr\n"), member_name);
+                    Output::send(STR("[Lua][Error] Tried setting member variable '{}' but UObject instance is nullptr\n"), ensure_str(member_name));
+                    lua.discard_value(1);
                     break;
                 default:
                     Output::send(STR("[Lua][Error] The UObject instance is nullptr & operation type was invalid\n"));
+                    lua.discard_value(1);
                     break;
                 }
 
                 return;
             }
 
-            Unreal::FName property_name = Unreal::FName(member_name, Unreal::FNAME_Find);
-            Unreal::FField* field = LuaCustomProperty::StaticStorage::property_list.find_or_nullptr(lua_object.get_remote_cpp_object(), member_name);
-
-            if (!field)
-            {
-                auto* object = lua_object.get_remote_cpp_object();
-                auto* obj_as_struct = Unreal::Cast<Unreal::UStruct>(object);
-                if (!obj_as_struct)
-                {
-                    obj_as_struct = object->GetClassPrivate();
-                }
-                field = obj_as_struct->FindProperty(property_name);
-            }
-
-            handle_unreal_property_value(operation, lua, lua_object.get_remote_cpp_object(), property_name, field);
+            const auto member = find_member_for_lua(lua_object.get_remote_cpp_object(), member_name);
+            lua.discard_value(1);
+            handle_unreal_property_value(operation, lua, lua_object.get_remote_cpp_object(), member.property_name, member.field, member.pusher);
         }
     };
 
@@ -882,14 +1007,14 @@ Overloads:
             Unreal::FName property_type = lua_object.m_property->GetClass().GetFName();
             int32_t type_name_comparison_index = property_type.GetComparisonIndex();
 
-            if (StaticState::m_property_value_pushers.contains(type_name_comparison_index))
+            if (auto pusher = StaticState::m_property_value_pushers.find(type_name_comparison_index))
             {
                 const PusherParams pusher_params{.operation = operation,
                                                  .lua = lua,
                                                  .base = lua_object.m_base,
                                                  .data = lua_object.get_local_cpp_object().get_data_ptr(),
                                                  .property = lua_object.m_property};
-                StaticState::m_property_value_pushers[type_name_comparison_index](pusher_params);
+                pusher(pusher_params);
             }
             else
             {
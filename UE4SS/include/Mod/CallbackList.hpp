@@ -0,0 +1,107 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <Mod/PublishedSnapshot.hpp>
+
+namespace RC
+{
+    // List of callbacks for a hook that can be iterated from any thread without a lock.
+    // Every change copies the list and publishes the copy, iteration works on whichever copy was published when it started.
+    // Changes are expected to be rare (mods registering hooks) compared to iteration (the hook being called).
+    // Replaced copies are kept alive until 'free_retired' is called, once all mods have been uninstalled.
+    template <typename CallbackType>
+    class CallbackList
+    {
+      public:
+        using Container = std::vector<CallbackType>;
+
+        class Snapshot
+        {
+          private:
+            // Null when the list is empty
+            const Container* m_callbacks{};
+
+          public:
+            explicit Snapshot(const Container* callbacks) : m_callbacks(callbacks)
+            {
+            }
+
+            auto begin() const -> typename Container::const_iterator
+            {
+                return m_callbacks ? m_callbacks->begin() : typename Container::const_iterator{};
+            }
+
+            auto end() const -> typename Container::const_iterator
+            {
+                return m_callbacks ? m_callbacks->end() : typename Container::const_iterator{};
+            }
+
+            auto empty() const -> bool
+            {
+                return !m_callbacks;
+            }
+        };
+
+      private:
+        // Null when the list is empty, so that hooks nobody registered for don't touch anything but the pointer
+        PublishedSnapshot<Container> m_callbacks{};
+        // Only taken by changes, so that two changes at the same time don't lose one of them
+        std::mutex m_modify_mutex{};
+
+      public:
+        auto snapshot() const -> Snapshot
+        {
+            return Snapshot{m_callbacks.load()};
+        }
+
+        auto empty() const -> bool
+        {
+            return !m_callbacks.load();
+        }
+
+        // Calls 'modifier' with a copy of the list, and publishes the copy once it returns
+        template <typename Callable>
+        auto modify(Callable&& modifier) -> void
+        {
+            std::lock_guard<std::mutex> lock{m_modify_mutex};
+            auto callbacks = std::make_unique<Container>();
+            if (const auto* current_callbacks = m_callbacks.load())
+            {
+                *callbacks = *current_callbacks;
+            }
+            modifier(*callbacks);
+            m_callbacks.publish(callbacks->empty() ? nullptr : std::move(callbacks));
+        }
+
+        auto add(CallbackType callback) -> void
+        {
+            modify([&](Container& callbacks) {
+                callbacks.emplace_back(std::move(callback));
+            });
+        }
+
+        template <typename Predicate>
+        auto erase_if(Predicate&& predicate) -> void
+        {
+            modify([&](Container& callbacks) {
+                std::erase_if(callbacks, predicate);
+            });
+        }
+
+        auto clear() -> void
+        {
+            std::lock_guard<std::mutex> lock{m_modify_mutex};
+            m_callbacks.publish(nullptr);
+        }
+
+        // Only safe when nothing can still be iterating a replaced copy
+        auto free_retired() -> void
+        {
+            m_callbacks.free_retired();
+        }
+    };
+} // namespace RC
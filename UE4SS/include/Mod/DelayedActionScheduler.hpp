@@ -0,0 +1,164 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <Common.hpp>
+#include <LuaMadeSimple/LuaMadeSimple.hpp>
+#include <SettingsManager.hpp>
+
+namespace RC
+{
+    // Status of a delayed action (mirrors UE's ETimerStatus)
+    enum class DelayedActionStatus : uint8_t
+    {
+        Pending,        // Created but not yet started
+        Active,         // Running, waiting for delay to expire
+        Paused,         // Timer paused, will resume when unpaused
+        Executing,      // Currently executing callback
+        PendingRemoval  // Marked for removal, will be cleaned up
+    };
+
+    struct DelayedGameThreadAction
+    {
+        const LuaMadeSimple::Lua* lua;
+        int32_t lua_action_function_ref{};
+        int32_t lua_action_thread_ref{};
+        GameThreadExecutionMethod method{GameThreadExecutionMethod::EngineTick};
+        DelayedActionStatus status{DelayedActionStatus::Active};
+        std::chrono::steady_clock::time_point execute_at{};  // Absolute time when action should execute
+        uint64_t execute_at_frame{0};  // Absolute engine tick when a frame-based action should execute
+        int64_t time_remaining_ms{0};  // Time remaining when paused (milliseconds)
+        int64_t frames_remaining{0};  // Frames remaining when paused, use DelayedActionScheduler::get_frames_remaining otherwise
+        int64_t delay_ms{0};  // Original delay in milliseconds (for loop/reset)
+        int64_t delay_frames{0};  // Original delay in frames (0 means use time-based delay)
+        int64_t handle{0};  // Unique handle for this action
+        bool is_retriggerable{false};  // If true, can be reset by calling with same handle
+        bool is_looping{false};  // If true, re-schedule after each execution
+        uint64_t schedule_id{0};  // Identifies the queue entry that's currently valid for this action, set by the scheduler
+    };
+
+    // Keeps delayed game thread actions in timer queues ordered by when they're due, so processing only looks at actions that are ready.
+    // Actions are looked up by handle in O(1).
+    // Time-based actions are queued per execution method, frame-based actions are counted in engine ticks & can only be executed by EngineTick.
+    // Not thread-safe, everything must be done with 'LuaMod::m_thread_actions_mutex' locked.
+    class RC_UE4SS_API DelayedActionScheduler
+    {
+      private:
+        struct TimerEntry
+        {
+            std::chrono::steady_clock::time_point execute_at{};
+            uint64_t schedule_id{};
+            int64_t handle{};
+        };
+
+        struct FrameEntry
+        {
+            uint64_t execute_at_frame{};
+            uint64_t schedule_id{};
+            int64_t handle{};
+        };
+
+        struct PendingUnref
+        {
+            const LuaMadeSimple::Lua* lua{};
+            int32_t lua_action_function_ref{};
+        };
+
+        // Only actions that haven't finished or been cancelled
+        std::unordered_map<int64_t, DelayedGameThreadAction> m_actions{};
+        // Min-heaps, entries whose 'schedule_id' no longer matches the action are skipped when they reach the top
+        std::vector<TimerEntry> m_timer_queues[2]{};
+        std::vector<FrameEntry> m_frame_queue{};
+        // Function refs of cancelled actions, released by the next call to 'process' since that's guaranteed to be on the game thread
+        std::vector<PendingUnref> m_pending_unrefs{};
+        uint64_t m_current_frame{};
+        uint64_t m_next_schedule_id{1};
+        std::chrono::microseconds m_time_budget{};
+
+      public:
+        // Limits how long a single call to 'process' can spend executing actions, the rest are executed by the next call
+        // At least one action is always executed, zero means no limit
+        auto set_time_budget(std::chrono::microseconds budget) -> void
+        {
+            m_time_budget = budget;
+        }
+
+        // Adds the action and schedules it from its delay
+        // An existing action with the same handle is cancelled, callers check for one first if that isn't what they want
+        auto add(DelayedGameThreadAction action) -> DelayedGameThreadAction&;
+        // Returns nullptr if the handle doesn't belong to an action, or if the action finished or was cancelled
+        auto find(int64_t handle) -> DelayedGameThreadAction*;
+        auto get_frames_remaining(const DelayedGameThreadAction& action) const -> int64_t;
+
+        // Sets the action to active & schedules it again from its delay
+        auto restart(DelayedGameThreadAction& action) -> void;
+        auto pause(DelayedGameThreadAction& action) -> void;
+        auto unpause(DelayedGameThreadAction& action) -> void;
+        // Removes the action, the reference passed in is invalid afterwards
+        auto cancel(DelayedGameThreadAction& action) -> void;
+        // Cancels every action belonging to the Lua thread and returns how many were cancelled
+        auto cancel_all_for(const LuaMadeSimple::Lua* lua) -> int64_t;
+        // Removes every action belonging to the Lua thread without releasing any references, for when its state is about to be closed
+        auto remove_all_for(const LuaMadeSimple::Lua* lua) -> void;
+
+        // Executes every action for this method that's due, calling 'execute' for each one
+        // Actions may be added, changed or cancelled while 'execute' is running
+        template <typename Callable>
+        auto process(GameThreadExecutionMethod method, Callable&& execute) -> void;
+
+      private:
+        auto schedule(DelayedGameThreadAction& action) -> void;
+        auto pop_due_action(GameThreadExecutionMethod method, std::chrono::steady_clock::time_point now) -> DelayedGameThreadAction*;
+        auto finish(DelayedGameThreadAction& action) -> void;
+        auto release_pending_unrefs() -> void;
+        auto compact_queues() -> void;
+    };
+
+    template <typename Callable>
+    auto DelayedActionScheduler::process(GameThreadExecutionMethod method, Callable&& execute) -> void
+    {
+        release_pending_unrefs();
+
+        if (method == GameThreadExecutionMethod::EngineTick)
+        {
+            ++m_current_frame;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        bool has_executed_any{};
+        while (auto action = pop_due_action(method, start))
+        {
+            if (has_executed_any && m_time_budget.count() > 0 && std::chrono::steady_clock::now() - start >= m_time_budget)
+            {
+                // Still due, the next call executes it
+                schedule(*action);
+                break;
+            }
+            has_executed_any = true;
+
+            // The callback can add or cancel actions, including this one, so it's looked up again afterwards
+            const auto handle = action->handle;
+            const auto schedule_id = action->schedule_id;
+            execute(*action);
+
+            action = find(handle);
+            if (!action || action->schedule_id != schedule_id || action->status != DelayedActionStatus::Active)
+            {
+                // Cancelled, paused or restarted by the callback
+                continue;
+            }
+
+            if (action->is_looping)
+            {
+                restart(*action);
+            }
+            else
+            {
+                finish(*action);
+            }
+        }
+    }
+} // namespace RC
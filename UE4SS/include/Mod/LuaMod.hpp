@@ -1,17 +1,25 @@
 #pragma once
 
+#include <atomic>
+#include <bitset>
 #include <chrono>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <filesystem>
+#include <functional>
 
 #include <Common.hpp>
 #include <File/File.hpp>
 #include <LuaMadeSimple/LuaMadeSimple.hpp>
+#include <Mod/CallbackList.hpp>
+#include <Mod/DelayedActionScheduler.hpp>
 #include <Mod/Mod.hpp>
+#include <Mod/PublishedSnapshot.hpp>
 #include <SettingsManager.hpp>
 
 #include <String/StringType.hpp>
@@ -24,7 +32,10 @@ namespace RC
 
     namespace Unreal
     {
+        class AActor;
         class UClass;
+        class UObjectBase;
+        class UStruct;
     }
 
     RC_UE4SS_API auto get_mod_ref(const LuaMadeSimple::Lua& lua) -> class LuaMod*;
@@ -55,34 +66,12 @@ namespace RC
             int32_t lua_action_thread_ref{};
         };
 
-        // Status of a delayed action (mirrors UE's ETimerStatus)
-        enum class DelayedActionStatus : uint8_t
-        {
-            Pending,        // Created but not yet started
-            Active,         // Running, waiting for delay to expire
-            Paused,         // Timer paused, will resume when unpaused
-            Executing,      // Currently executing callback
-            PendingRemoval  // Marked for removal, will be cleaned up
-        };
-
-        struct DelayedGameThreadAction
-        {
-            const LuaMadeSimple::Lua* lua;
-            int32_t lua_action_function_ref{};
-            int32_t lua_action_thread_ref{};
-            GameThreadExecutionMethod method{GameThreadExecutionMethod::EngineTick};
-            DelayedActionStatus status{DelayedActionStatus::Active};
-            std::chrono::steady_clock::time_point execute_at{};  // Absolute time when action should execute
-            int64_t time_remaining_ms{0};  // Time remaining when paused (milliseconds)
-            int64_t frames_remaining{0};  // Countdown for frame-based delays
-            int64_t delay_ms{0};  // Original delay in milliseconds (for loop/reset)
-            int64_t delay_frames{0};  // Original delay in frames (0 means use time-based delay)
-            int64_t handle{0};  // Unique handle for this action
-            bool is_retriggerable{false};  // If true, can be reset by calling with same handle
-            bool is_looping{false};  // If true, re-schedule after each execution
-        };
+        using DelayedActionStatus = RC::DelayedActionStatus;
+        using DelayedGameThreadAction = RC::DelayedGameThreadAction;
 
         static inline int64_t m_next_delayed_action_handle{1};
+        // Returns the next handle that isn't used by a delayed action, 'm_thread_actions_mutex' must be locked
+        static auto make_delayed_action_handle() -> int64_t;
 
         struct AsyncAction
         {
@@ -126,36 +115,74 @@ namespace RC
             int32_t lua_callback_function_ref{};
             int32_t lua_callback_thread_ref{};
         };
+        struct LuaActorBatchCallbackData
+        {
+            // Handed to Lua as the id to unregister with, taken from 'm_next_actor_batch_callback_id' so ids only ever increase
+            int64_t callback_id{};
+            const LuaMadeSimple::Lua* lua;
+            Unreal::UClass* instance_of_class;
+            int32_t lua_callback_function_ref{};
+            // Actors that matched since the last engine tick, plus the reason for each one in EndPlay batches
+            std::vector<Unreal::AActor*> pending_actors{};
+            std::vector<int32_t> pending_end_play_reasons{};
+        };
         struct FunctionHookData
         {
             std::vector<Unreal::FName> names{};
             LuaCallbackData callback_data{};
         };
-        static inline std::vector<LuaCancellableCallbackData> m_static_construct_object_lua_callbacks;
-        static inline std::vector<LuaCallbackData> m_process_console_exec_pre_callbacks;
-        static inline std::vector<LuaCallbackData> m_process_console_exec_post_callbacks;
-        static inline std::vector<LuaCallbackData> m_call_function_by_name_with_arguments_pre_callbacks;
-        static inline std::vector<LuaCallbackData> m_call_function_by_name_with_arguments_post_callbacks;
-        static inline std::vector<LuaCallbackData> m_local_player_exec_pre_callbacks;
-        static inline std::vector<LuaCallbackData> m_local_player_exec_post_callbacks;
+        // Callbacks for 'NotifyOnNewObject', by the class they were registered for
+        using StaticConstructObjectCallbacks = std::unordered_map<Unreal::UClass*, std::vector<LuaCancellableCallbackData>>;
+        struct StaticConstructObjectIndex
+        {
+            StaticConstructObjectCallbacks callbacks{};
+            // Bloom filter of the classes in 'callbacks'
+            // Every object construction walks its class chain, and a class is only looked up in the map if its bit is set
+            std::bitset<1024> class_filter{};
+        };
+        // Published as an immutable snapshot, objects are constructed on any thread and a callback can register more callbacks
+        // Null when there are no callbacks, only changed through 'modify_static_construct_object_callbacks'
+        static inline PublishedSnapshot<StaticConstructObjectIndex> m_static_construct_object_index{};
+        static inline std::mutex m_static_construct_object_modify_mutex{};
+        static inline CallbackList<LuaCallbackData> m_process_console_exec_pre_callbacks{};
+        static inline CallbackList<LuaCallbackData> m_process_console_exec_post_callbacks{};
+        static inline CallbackList<LuaCallbackData> m_call_function_by_name_with_arguments_pre_callbacks{};
+        static inline CallbackList<LuaCallbackData> m_call_function_by_name_with_arguments_post_callbacks{};
+        static inline CallbackList<LuaCallbackData> m_local_player_exec_pre_callbacks{};
+        static inline CallbackList<LuaCallbackData> m_local_player_exec_post_callbacks{};
         static inline std::unordered_map<File::StringType, LuaCallbackData> m_global_command_lua_callbacks;
         static inline std::unordered_map<File::StringType, LuaCallbackData> m_custom_command_lua_pre_callbacks;
         static inline std::vector<SimpleLuaAction> m_game_thread_actions{};
         static inline std::vector<SimpleLuaAction> m_engine_tick_actions{};
-        static inline std::vector<DelayedGameThreadAction> m_delayed_game_thread_actions{};
+        static inline DelayedActionScheduler m_delayed_game_thread_actions{};
         static inline GameThreadExecutionMethod m_default_game_thread_method{GameThreadExecutionMethod::EngineTick};
         // This is storage that persists through hot-reloads.
         static inline std::unordered_map<std::string, SharedLuaVariable> m_shared_lua_variables{};
         static inline std::vector<FunctionHookData> m_custom_event_callbacks{};
-        static inline std::vector<LuaCallbackData> m_load_map_pre_callbacks{};
-        static inline std::vector<LuaCallbackData> m_load_map_post_callbacks{};
-        static inline std::vector<LuaCallbackData> m_init_game_state_pre_callbacks{};
-        static inline std::vector<LuaCallbackData> m_init_game_state_post_callbacks{};
-        static inline std::vector<LuaCallbackData> m_begin_play_pre_callbacks{};
-        static inline std::vector<LuaCallbackData> m_begin_play_post_callbacks{};
-        static inline std::vector<LuaCallbackData> m_end_play_pre_callbacks{};
-        static inline std::vector<LuaCallbackData> m_end_play_post_callbacks{};
+        static inline CallbackList<LuaCallbackData> m_load_map_pre_callbacks{};
+        static inline CallbackList<LuaCallbackData> m_load_map_post_callbacks{};
+        static inline CallbackList<LuaCallbackData> m_init_game_state_pre_callbacks{};
+        static inline CallbackList<LuaCallbackData> m_init_game_state_post_callbacks{};
+        static inline CallbackList<LuaCallbackData> m_begin_play_pre_callbacks{};
+        static inline CallbackList<LuaCallbackData> m_begin_play_post_callbacks{};
+        static inline CallbackList<LuaCallbackData> m_end_play_pre_callbacks{};
+        static inline CallbackList<LuaCallbackData> m_end_play_post_callbacks{};
+        // Callbacks for 'RegisterBeginPlayBatchHook' & 'RegisterEndPlayBatchHook', each one gets the actors that matched its class once per engine tick
+        // Guarded by 'm_actor_batches_mutex', which is never held while calling into Lua, because actors are removed from the batches when they're deleted
+        static inline std::vector<LuaActorBatchCallbackData> m_begin_play_batch_callbacks{};
+        static inline std::vector<LuaActorBatchCallbackData> m_end_play_batch_callbacks{};
+        static inline std::mutex m_actor_batches_mutex{};
+        // Batches are appended with the next id, so both containers are always sorted by id
+        static inline int64_t m_next_actor_batch_callback_id{1};
+        // Every actor that's waiting in a batch, and how many batches it's waiting in
+        // Objects are deleted constantly, this lets the delete listener skip the batches for every object that isn't waiting in one
+        static inline std::unordered_map<const Unreal::UObjectBase*, uint32_t> m_pending_batched_actors{};
+        static inline std::atomic<size_t> m_pending_batched_actor_count{};
         static inline std::vector<FunctionHookData> m_script_hook_callbacks{};
+        // Function names of every entry in 'm_custom_event_callbacks' & 'm_script_hook_callbacks', see 'rebuild_script_hook_index'
+        // The script hook runs for every Blueprint function call and only locks & searches the containers when the called function's name is in here
+        // Published as an immutable snapshot so that it can be probed without a lock, null when there are no script hooks at all
+        static inline PublishedSnapshot<std::unordered_set<Unreal::FName>> m_script_hook_names{};
         static inline bool m_is_currently_executing_game_action{};
         static inline std::recursive_mutex m_thread_actions_mutex{};
 
@@ -163,10 +190,13 @@ namespace RC
         std::jthread m_async_thread;
         std::thread::id m_main_thread_id{};
         bool m_processing_events{};
-        bool m_pause_events_processing{};
         bool m_is_process_event_hooked{};
         static inline bool m_is_engine_tick_hooked{};
         std::mutex m_actions_lock{};
+        // Wakes the async thread when an action is queued, the thread otherwise sleeps until the next delayed action is due
+        std::condition_variable_any m_actions_cv{};
+        // Seconds spent in 'precompile_scripts', reported together with the other startup phases
+        double m_compile_duration{};
 
       public:
         LuaMod(UE4SSProgram&, StringType&& mod_name, StringType&& mod_path);
@@ -198,6 +228,10 @@ namespace RC
 
         auto prepare_mod(const LuaMadeSimple::Lua& lua) -> void;
 
+        // Reads & compiles main.lua and every module it requires by a literal name into the bytecode cache
+        // Doesn't touch any Lua state so it can run on any thread before 'start_mod', which then only has to load the bytecode
+        auto precompile_scripts() -> void;
+
         RC_UE4SS_API auto lua() const -> const LuaMadeSimple::Lua&;
         RC_UE4SS_API auto main_lua() const -> const LuaMadeSimple::Lua*;
         RC_UE4SS_API auto async_lua() const -> const LuaMadeSimple::Lua*;
@@ -234,6 +268,8 @@ namespace RC
         // Used when the main update function would block other mods from executing their scripts
         auto update_async() -> void override;
 
+        // Queues an action for the async thread & wakes it up
+        auto queue_async_action(AsyncAction action) -> void;
         auto process_delayed_actions() -> void;
         auto clear_delayed_actions() -> void;
 
@@ -246,6 +282,11 @@ namespace RC
         static auto remove_function_hook_data(std::vector<FunctionHookData>&, Unreal::FName) -> void;
         static auto remove_function_hook_data(std::vector<FunctionHookData>&, const Unreal::UObject*) -> void;
         static auto remove_function_hook_data(std::vector<FunctionHookData>&, const std::vector<Unreal::FName>&) -> void;
+        // Must be called with 'm_thread_actions_mutex' locked after adding to or removing from the script hook or custom event containers
+        static auto rebuild_script_hook_index() -> void;
+        // Calls 'modifier' with a copy of the 'NotifyOnNewObject' callbacks, and publishes the copy along with a rebuilt class filter once it returns
+        static auto modify_static_construct_object_callbacks(const std::function<void(StaticConstructObjectCallbacks&)>& modifier) -> void;
+        static auto get_static_construct_object_filter_bit(const Unreal::UStruct*) -> size_t;
     };
 
     struct LuaStatics
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace RC
+{
+    // Immutable value that's replaced as a whole, and read from any thread without a lock.
+    // Reading is a single load of a raw pointer, which is lock-free on every compiler, std::atomic<std::shared_ptr> isn't on MSVC.
+    // A reader can still be using a value after it's been replaced, so replaced values are kept alive until 'free_retired' is called.
+    template <typename ValueType>
+    class PublishedSnapshot
+    {
+      private:
+        std::atomic<const ValueType*> m_current{};
+        // Owns the current value and every value it replaced
+        std::vector<std::unique_ptr<const ValueType>> m_values{};
+        std::mutex m_publish_mutex{};
+
+      public:
+        // Null until something is published, and after null is published
+        auto load() const -> const ValueType*
+        {
+            return m_current.load(std::memory_order_acquire);
+        }
+
+        auto publish(std::unique_ptr<const ValueType> value) -> void
+        {
+            std::lock_guard<std::mutex> lock{m_publish_mutex};
+            const auto* new_value = value.get();
+            if (value)
+            {
+                m_values.emplace_back(std::move(value));
+            }
+            m_current.store(new_value, std::memory_order_release);
+        }
+
+        // Frees every value except the current one
+        // Only safe when nothing can still be reading a replaced value, which is the case once all mods have been uninstalled
+        auto free_retired() -> void
+        {
+            std::lock_guard<std::mutex> lock{m_publish_mutex};
+            const auto* current = m_current.load(std::memory_order_relaxed);
+            std::erase_if(m_values, [&](const auto& value) {
+                return value.get() != current;
+            });
+        }
+    };
+} // namespace RC
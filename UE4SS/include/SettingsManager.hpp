@@ -7,6 +7,8 @@
 #include <File/File.hpp>
 #include <GUI/GUI.hpp>
 #include <Input/KeyDef.hpp>
+#include <SigScanner/SinglePassSigScanner.hpp>
+#include <USMapGenerator/Generator.hpp>
 #include <Unreal/UnrealInitializer.hpp>
 
 namespace RC
@@ -40,6 +42,7 @@ namespace RC
             bool DoEarlyScan{false};
             bool SearchByAddress{false};
             GameThreadExecutionMethod DefaultExecuteInGameThreadMethod{GameThreadExecutionMethod::EngineTick};
+            float DelayedActionTimeBudgetMs{0.0f};
         } General;
 
         struct SectionEngineVersionOverride
@@ -72,12 +75,26 @@ namespace RC
             bool MakeAllConfigsEngineConfig{};
         } UHTHeaderGenerator;
 
+        struct SectionUsmapGenerator
+        {
+            OutTheShade::EUsmapCompressionMethod CompressionMethod{OutTheShade::EUsmapCompressionMethod::None};
+            // The value of 'CompressionMethod' if it wasn't recognized, settings are loaded before the log exists so the generator reports it
+            StringType UnknownCompressionMethod{};
+        } UsmapGenerator;
+
+        struct SectionLua
+        {
+            bool CacheBytecodeOnDisk{true};
+            bool EnableNativeCodeGen{true};
+        } Lua;
+
         struct SectionDebug
         {
             bool SimpleConsoleEnabled{true};
             bool DebugConsoleEnabled{true};
             bool DebugConsoleVisible{true};
             float DebugGUIFontScaling{1.0};
+            int64_t AsyncLogFileFlushIntervalMs{0};
             GUI::GfxBackend GraphicsAPI{GUI::GfxBackend::GLFW3_OpenGL3};
             GUI::RenderMode RenderMode{GUI::RenderMode::ExternalThread};
         } Debug;
@@ -92,6 +109,7 @@ namespace RC
         {
             int64_t SigScannerNumThreads{8};
             int64_t SigScannerMultithreadingModuleSizeThreshold{16777216};
+            SinglePassScanner::ScanMethod SigScannerScanMethod{SinglePassScanner::ScanMethod::Scalar};
         } Threads;
 
         struct SectionMemory
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <mutex>
 #include <string>
@@ -139,6 +140,8 @@ namespace RC
         };
         std::vector<EventCallable> m_queued_events{};
         std::mutex m_event_queue_mutex{};
+        // Signalled when an event is queued or the event loop is shutting down, so the loop doesn't have to wait for its next tick
+        std::condition_variable m_event_queue_cv{};
         std::mutex m_render_thread_mutex{};
         std::thread::id m_event_loop_thread_id{};
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <USMapWriter/UsmapFile.hpp>
+
 namespace RC::OutTheShade
 {
     auto generate_usmap() -> void;
@@ -26,6 +26,9 @@ namespace RC
 
     LONG WINAPI ExceptionHandler(_EXCEPTION_POINTERS* exception_pointers)
     {
+        // The log file may be written in batches, make sure whatever led up to the crash ends up in it
+        Output::flush_all_default_devices();
+
         StringType dump_path = fmt::format(STR("{}\\crash_{}.dmp"), StringType{UE4SSProgram::get_program().get_working_directory()}, get_now_as_string(STR("{:%Y_%m_%d_%H_%M_%S}")));
 
         const HANDLE file =
@@ -1,5 +1,7 @@
+#include <algorithm>
 #include <ctype.h>
 #include <memory>
+#include <thread>
 
 #include <DynamicOutput/DynamicOutput.hpp>
 #include <GUI/Console.hpp>
@@ -62,6 +64,18 @@ namespace RC::GUI
         return p;
     }
 
+    auto Console::make_text_editor() -> std::unique_ptr<TextEditor>
+    {
+        auto text_editor = std::make_unique<TextEditor>();
+        text_editor->SetConsoleMode(true);
+        text_editor->SetColorizerEnable(false);
+        text_editor->SetLanguageDefinition(GetLanguageDefinitionNone());
+        text_editor->SetPalette(GetPalette());
+        text_editor->SetBreakpoints(m_breakpoints);
+        text_editor->SetTextFilter(&m_filter);
+        return text_editor;
+    }
+
     auto Console::render() -> void
     {
         /*
@@ -129,8 +143,8 @@ namespace RC::GUI
 
         /**/
 
-        std::lock_guard<std::mutex> guard(m_lines_mutex);
-        m_text_editor.Render("TextEditor", {-16.0f, -31.0f + -8.0f});
+        drain_pending_lines();
+        m_text_editor->Render("TextEditor", {-16.0f, -31.0f + -8.0f});
 
         ImGui_AutoScroll("TextEditor", &m_previous_max_scroll_y);
         //*/
@@ -166,50 +180,120 @@ namespace RC::GUI
         throw std::runtime_error{"[LogLevel_to_ImColor] Unhandled log_level"};
     }
 
-    auto Console::add_line(const std::string& line, Color::Color color) -> void
+    static auto lock_slot(std::atomic_flag& is_locked) -> void
+    {
+        while (is_locked.test_and_set(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    auto Console::push_pending_line(std::string&& line, Color::Color color) -> void
     {
-        std::lock_guard<std::mutex> guard(m_lines_mutex);
-        if (m_text_editor.GetTotalLines() < 0)
+        const auto position = m_next_write_position.fetch_add(1, std::memory_order_acq_rel);
+        auto& slot = m_pending_lines[position % m_maximum_num_lines];
+        lock_slot(slot.is_locked);
+        // A writer that was descheduled for a whole lap must not overwrite the newer line that's already in the slot
+        if (slot.written_position < position + 1)
         {
-            throw std::runtime_error{"Somehow we negative amount of lines in the console"};
+            slot.line = ConsoleLine{std::move(line), color};
+            slot.written_position = position + 1;
         }
-        if (static_cast<size_t>(m_text_editor.GetTotalLines()) >= m_maximum_num_lines)
+        slot.is_locked.clear(std::memory_order_release);
+    }
+
+    auto Console::read_pending_line(uint64_t position, ConsoleLine& out_line) -> ReadLineResult
+    {
+        auto& slot = m_pending_lines[position % m_maximum_num_lines];
+        lock_slot(slot.is_locked);
+        auto result = ReadLineResult::Read;
+        if (slot.written_position < position + 1)
         {
-            m_text_editor.ClearLines();
+            result = ReadLineResult::NotWrittenYet;
         }
-        if (m_lines.size() >= m_maximum_num_lines)
+        else if (slot.written_position > position + 1)
         {
-            m_lines.clear();
+            result = ReadLineResult::Overwritten;
         }
-        if (color != Color::Default && color != Color::NoColor)
+        else
         {
-            m_text_editor.GetLineColorMarkers().emplace(m_text_editor.GetTotalLines() + 1, LogLevel_to_ImColor(color));
+            out_line = slot.line;
         }
-        m_lines.emplace_back(line);
-        m_text_editor.AddTextLine(line);
+        slot.is_locked.clear(std::memory_order_release);
+        return result;
     }
 
-    auto Console::add_line(const StringType& line, Color::Color color) -> void
+    auto Console::drain_pending_lines() -> void
     {
-        auto utf8_string = to_string(line);
-        std::lock_guard<std::mutex> guard(m_lines_mutex);
-        if (m_text_editor.GetTotalLines() < 0)
+        const auto write_position = m_next_write_position.load(std::memory_order_acquire);
+        if (write_position - m_next_read_position > m_maximum_num_lines)
+        {
+            // The render thread fell more than a full buffer behind, e.g. while the console tab wasn't open, so the oldest lines are gone
+            m_next_read_position = write_position - m_maximum_num_lines;
+        }
+
+        const auto first_new_position = m_next_read_position;
+        ConsoleLine line{};
+        for (; m_next_read_position < write_position; ++m_next_read_position)
+        {
+            const auto result = read_pending_line(m_next_read_position, line);
+            if (result == ReadLineResult::NotWrittenYet)
+            {
+                // The position has been claimed but the line hasn't been written yet, it's picked up next frame so lines stay in order
+                break;
+            }
+            if (result == ReadLineResult::Read)
+            {
+                add_line_to_text_editor(*m_text_editor, line);
+            }
+        }
+
+        if (!m_next_text_editor && static_cast<size_t>(m_text_editor->GetTotalLines()) >= m_maximum_num_lines)
+        {
+            // Evicting the oldest quarter, the replacement starts from the newest three quarters that are still in the ring buffer
+            m_next_text_editor = make_text_editor();
+            m_next_text_editor_read_position = m_next_read_position - std::min(m_next_read_position, static_cast<uint64_t>(m_maximum_num_lines / 4 * 3));
+        }
+        if (!m_next_text_editor)
         {
-            throw std::runtime_error{"Somehow we negative amount of lines in the console"};
+            return;
         }
-        if (static_cast<size_t>(m_text_editor.GetTotalLines()) >= m_maximum_num_lines)
+
+        // Lines logged this frame are refilled on top of the usual amount, so the replacement always catches up with the shown editor
+        const auto num_lines_to_refill = m_num_lines_to_refill_per_frame + (m_next_read_position - first_new_position);
+        m_next_text_editor_read_position = std::max(m_next_text_editor_read_position, write_position - std::min(write_position, static_cast<uint64_t>(m_maximum_num_lines)));
+        const auto refill_end_position = std::min(m_next_read_position, m_next_text_editor_read_position + num_lines_to_refill);
+        for (; m_next_text_editor_read_position < refill_end_position; ++m_next_text_editor_read_position)
         {
-            m_text_editor.ClearLines();
+            // Lines before 'm_next_read_position' have all been written, a line can only be missing if it was overwritten
+            if (read_pending_line(m_next_text_editor_read_position, line) == ReadLineResult::Read)
+            {
+                add_line_to_text_editor(*m_next_text_editor, line);
+            }
         }
-        if (m_lines.size() >= m_maximum_num_lines)
+
+        if (m_next_text_editor_read_position == m_next_read_position)
         {
-            m_lines.clear();
+            m_text_editor = std::move(m_next_text_editor);
         }
-        if (color != Color::Default && color != Color::NoColor)
+    }
+
+    auto Console::add_line_to_text_editor(TextEditor& text_editor, const ConsoleLine& line) -> void
+    {
+        if (line.color != Color::Default && line.color != Color::NoColor)
         {
-            m_text_editor.GetLineColorMarkers().emplace(m_text_editor.GetTotalLines() + 1, LogLevel_to_ImColor(color));
+            text_editor.GetLineColorMarkers().emplace(text_editor.GetTotalLines() + 1, LogLevel_to_ImColor(line.color));
         }
-        m_lines.emplace_back(utf8_string);
-        m_text_editor.AddTextLine(utf8_string);
+        text_editor.AddTextLine(line.text);
+    }
+
+    auto Console::add_line(const std::string& line, Color::Color color) -> void
+    {
+        push_pending_line(std::string{line}, color);
+    }
+
+    auto Console::add_line(const StringType& line, Color::Color color) -> void
+    {
+        push_pending_line(to_string(line), color);
     }
 } // namespace RC::GUI
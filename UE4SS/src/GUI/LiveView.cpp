@@ -1,8 +1,11 @@
 #include <algorithm>
+#include <cctype>
 #include <format>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <variant>
@@ -63,13 +66,16 @@ namespace RC::GUI
     static std::unordered_map<const UObject*, std::string> s_object_ptr_to_full_name{};
 
     static std::mutex s_object_ptr_to_full_name_mutex{};
+    // Guards 's_name_search_results', 's_name_search_result_indices' & 's_first_removed_search_result_index'
+    // The search and the create listener add results, and the delete listener removes them on whatever thread GC runs on
+    static std::mutex s_name_search_results_mutex{};
     std::mutex LiveView::Watch::s_watch_lock{};
 
     std::vector<LiveView::ObjectOrProperty> LiveView::s_object_view_history{{nullptr, nullptr, false}};
     size_t LiveView::s_currently_selected_object_index{};
     std::unordered_map<UObject*, std::vector<size_t>> LiveView::s_history_object_to_index{{nullptr, {0}}};
     std::vector<UObject*> LiveView::s_name_search_results{};
-    std::unordered_set<UObject*> LiveView::s_name_search_results_set{};
+    std::unordered_map<UObject*, size_t> LiveView::s_name_search_result_indices{};
     std::string LiveView::s_name_to_search_by{};
     std::vector<std::unique_ptr<LiveView::Watch>> LiveView::s_watches{};
     std::unordered_map<LiveView::WatchIdentifier, LiveView::Watch*> LiveView::s_watch_map;
@@ -116,13 +122,91 @@ namespace RC::GUI
 
     static auto get_object_full_name_cxx_string(UObject* object) -> std::string;
 
+    struct CaseInsensitiveCharHash
+    {
+        auto operator()(char c) const -> size_t
+        {
+            return std::hash<char>{}(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+        }
+    };
+
+    struct CaseInsensitiveCharEqual
+    {
+        auto operator()(char a, char b) const -> bool
+        {
+            return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+        }
+    };
+
+    // Built once per search from 's_name_to_search_by' instead of lowercasing & compiling the search string for every object
+    // Names are matched case-insensitively in place, so the cached full names don't have to be copied & lowercased either
+    struct NameSearchMatcher
+    {
+        using Searcher = std::boyer_moore_horspool_searcher<std::string::const_iterator, CaseInsensitiveCharHash, CaseInsensitiveCharEqual>;
+
+        std::string name_to_search_by{};
+        std::optional<Searcher> searcher{};
+        std::optional<std::regex> regex{};
+
+        // Throws if the search string isn't a valid regex
+        auto build(const std::string& new_name_to_search_by, bool use_regex) -> void
+        {
+            searcher.reset();
+            regex.reset();
+            name_to_search_by = new_name_to_search_by;
+            std::transform(name_to_search_by.begin(), name_to_search_by.end(), name_to_search_by.begin(), [](char c) {
+                return std::tolower(c);
+            });
+
+            if (use_regex)
+            {
+                regex.emplace(name_to_search_by, std::regex::icase | std::regex::optimize);
+            }
+            else
+            {
+                searcher.emplace(name_to_search_by.cbegin(), name_to_search_by.cend());
+            }
+        }
+
+        auto matches(const std::string& name) const -> bool
+        {
+            if (regex)
+            {
+                return std::regex_search(name, *regex);
+            }
+            if (searcher)
+            {
+                return std::search(name.cbegin(), name.cend(), *searcher) != name.cend();
+            }
+            return false;
+        }
+    };
+    static NameSearchMatcher s_name_search_matcher{};
+
+    static auto object_full_name_matches_search(UObject* object) -> bool;
+
+    static auto add_search_result(UObject* object) -> void
+    {
+        std::lock_guard lock{s_name_search_results_mutex};
+        if (LiveView::s_name_search_result_indices.try_emplace(object, LiveView::s_name_search_results.size()).second)
+        {
+            LiveView::s_name_search_results.emplace_back(object);
+        }
+    }
+
+    static auto is_search_result(UObject* object) -> bool
+    {
+        std::lock_guard lock{s_name_search_results_mutex};
+        return LiveView::s_name_search_result_indices.contains(object);
+    }
+
     static auto filter_out_objects(UObject* object) -> Filter::FilterResult
     {
         if (const auto result = eval_pre_search_filters(SearchFilters, object); RC_LIVE_VIEW_WAS_FILTERED(result))
         {
             return result;
         }
-        if (!LiveView::s_name_to_search_by.empty() && LiveView::s_name_search_results_set.contains(object))
+        if (!LiveView::s_name_to_search_by.empty() && is_search_result(object))
         {
             return RC_LIVE_VIEW_MAKE_FILTER_RETURN_VALUE(true, STR("No name to search for, and object not in result set"));
         }
@@ -133,7 +217,9 @@ namespace RC::GUI
         return RC_LIVE_VIEW_MAKE_FILTER_RETURN_VALUE(false, {});
     }
 
-    static auto attempt_to_add_search_result(UObject* object, bool ignore_name = false) -> Filter::FilterResult
+    // 'inheritance_matches' remembers which classes have a matching super struct, it's only passed in by a full search since the result is the same for every instance
+    static auto attempt_to_add_search_result(UObject* object, bool ignore_name = false, std::unordered_map<UStruct*, bool>* inheritance_matches = nullptr)
+            -> Filter::FilterResult
     {
         // TODO: Stop using the 'HashObject' function when needing the address of an FFieldClassVariant because it's not designed to return an address.
         //       Maybe make the ToFieldClass/ToUClass functions public (append 'Unsafe' to the function names).
@@ -143,15 +229,6 @@ namespace RC::GUI
             return RC_LIVE_VIEW_MAKE_FILTER_RETURN_VALUE(true, STR("Searched by name, but no name supplied"));
         }
 
-        std::string name_to_search_by{};
-        if (!ignore_name)
-        {
-            name_to_search_by = LiveView::s_name_to_search_by;
-            std::transform(name_to_search_by.begin(), name_to_search_by.end(), name_to_search_by.begin(), [](char c) {
-                return std::tolower(c);
-            });
-        }
-
         if (const auto result = filter_out_objects(object); RC_LIVE_VIEW_WAS_FILTERED(result))
         {
             return result;
@@ -159,58 +236,50 @@ namespace RC::GUI
 
         if (LiveView::s_include_inheritance && !ignore_name)
         {
-            for (UStruct* super : TSuperStructRange(object->GetClassPrivate()))
-            {
-                auto super_full_name = get_object_full_name_cxx_string(super);
-                std::transform(super_full_name.begin(), super_full_name.end(), super_full_name.begin(), [](char c) {
-                    return std::tolower(c);
-                });
-                if (super_full_name.find(name_to_search_by) != super_full_name.npos)
+            const auto has_matching_super = [](UClass* object_class) {
+                for (UStruct* super : TSuperStructRange(object_class))
                 {
-                    LiveView::s_name_search_results.emplace_back(object);
-                    LiveView::s_name_search_results_set.emplace(object);
-                    break;
+                    if (object_full_name_matches_search(super))
+                    {
+                        return true;
+                    }
                 }
-            }
-        }
-
-        if (LiveView::s_include_inheritance && LiveView::s_name_search_results_set.contains(object))
-        {
-            return RC_LIVE_VIEW_MAKE_FILTER_RETURN_VALUE(true, STR("Include inheritance, but object not inside result set"));
-        }
-
-        auto object_full_name = get_object_full_name_cxx_string(object);
-        std::transform(object_full_name.begin(), object_full_name.end(), object_full_name.begin(), [](char c) {
-            return std::tolower(c);
-        });
+                return false;
+            };
 
-        if (LiveView::s_use_regex_for_search && !ignore_name)
-        {
-            try
+            auto object_class = object->GetClassPrivate();
+            bool matched{};
+            if (inheritance_matches)
             {
-                if (std::regex_search(object_full_name.begin(), object_full_name.end(), std::regex(name_to_search_by)))
+                auto [it, inserted] = inheritance_matches->try_emplace(object_class);
+                if (inserted)
                 {
-                    LiveView::s_name_search_results.emplace_back(object);
-                    LiveView::s_name_search_results_set.emplace(object);
+                    it->second = has_matching_super(object_class);
                 }
+                matched = it->second;
             }
-            catch (std::exception& e)
+            else
             {
-                UE4SS_ERROR_OUTPUTTER()
-                LiveView::s_name_to_search_by.clear();
-                s_live_view->set_is_searching_by_name(false);
-                s_live_view->set_search_field_clear_requested(true);
+                matched = has_matching_super(object_class);
+            }
+
+            if (matched)
+            {
+                add_search_result(object);
             }
-            return RC_LIVE_VIEW_MAKE_FILTER_RETURN_VALUE(false, STR("regex"));
         }
 
-        if (ignore_name || object_full_name.find(name_to_search_by) != object_full_name.npos)
+        if (LiveView::s_include_inheritance && is_search_result(object))
         {
-            LiveView::s_name_search_results.emplace_back(object);
-            LiveView::s_name_search_results_set.emplace(object);
+            return RC_LIVE_VIEW_MAKE_FILTER_RETURN_VALUE(true, STR("Include inheritance, but object not inside result set"));
+        }
+
+        if (ignore_name || object_full_name_matches_search(object))
+        {
+            add_search_result(object);
         }
 
-        return RC_LIVE_VIEW_MAKE_FILTER_RETURN_VALUE(false, STR("not regex"));
+        return RC_LIVE_VIEW_MAKE_FILTER_RETURN_VALUE(false, LiveView::s_use_regex_for_search ? STR("regex") : STR("not regex"));
     }
 
     static void attempt_to_add_search_by_address_result(uintptr_t address_to_search_by, UObject* object)
@@ -225,21 +294,46 @@ namespace RC::GUI
         uintptr_t object_size = uclass->GetPropertiesSize();
         if (address_to_search_by < object_addr + object_size)
         {
-            LiveView::s_name_search_results.emplace_back(object);
-            LiveView::s_name_search_results_set.emplace(object);
+            add_search_result(object);
         }
     }
 
-    static auto remove_search_result(UObject* object) -> void
+    // Index of the first result that 'remove_search_result' left a null behind in, or the size of the results if there's none
+    static size_t s_first_removed_search_result_index{std::numeric_limits<size_t>::max()};
+
+    // Drops the nulls left behind by 'remove_search_result' while keeping the remaining results in the order they were found in
+    // Called before the results are read, so a GC that deletes many results at once only moves the results once
+    // 's_name_search_results_mutex' must be locked
+    static auto compact_search_results() -> void
     {
-        LiveView::s_name_search_results.erase(std::remove_if(LiveView::s_name_search_results.begin(),
-                                                             LiveView::s_name_search_results.end(),
-                                                             [&](const auto& item) {
-                                                                 return item == object;
-                                                             }),
-                                              LiveView::s_name_search_results.end());
+        auto& results = LiveView::s_name_search_results;
+        if (s_first_removed_search_result_index >= results.size())
+        {
+            s_first_removed_search_result_index = std::numeric_limits<size_t>::max();
+            return;
+        }
+
+        const auto first_removed = results.begin() + static_cast<ptrdiff_t>(s_first_removed_search_result_index);
+        results.erase(std::remove(first_removed, results.end(), nullptr), results.end());
+        for (size_t i = s_first_removed_search_result_index; i < results.size(); ++i)
+        {
+            LiveView::s_name_search_result_indices[results[i]] = i;
+        }
+        s_first_removed_search_result_index = std::numeric_limits<size_t>::max();
+    }
 
-        LiveView::s_name_search_results_set.erase(object);
+    static auto remove_search_result(UObject* object) -> void
+    {
+        // Objects are deleted in bulk by GC so this runs a lot, the result is only nulled here and 'compact_search_results' erases it later
+        {
+            std::lock_guard lock{s_name_search_results_mutex};
+            if (auto it = LiveView::s_name_search_result_indices.find(object); it != LiveView::s_name_search_result_indices.end())
+            {
+                LiveView::s_name_search_results[it->second] = nullptr;
+                s_first_removed_search_result_index = std::min(s_first_removed_search_result_index, it->second);
+                LiveView::s_name_search_result_indices.erase(it);
+            }
+        }
 
         {
             std::lock_guard<decltype(LiveView::Watch::s_watch_lock)> lock{LiveView::Watch::s_watch_lock};
@@ -946,18 +1040,41 @@ namespace RC::GUI
         }
     }
 
+    static auto object_full_name_matches_search(UObject* object) -> bool
+    {
+        if (!UnrealInitializer::StaticStorage::bIsInitialized)
+        {
+            return false;
+        }
+        // Matched while locked so the cached name doesn't have to be copied out
+        std::lock_guard lock{s_object_ptr_to_full_name_mutex};
+        auto it = s_object_ptr_to_full_name.find(object);
+        if (it == s_object_ptr_to_full_name.end())
+        {
+            it = s_object_ptr_to_full_name.emplace(object, to_string(object->GetFullName())).first;
+        }
+        return s_name_search_matcher.matches(it->second);
+    }
+
     auto LiveView::guobjectarray_by_name_iterator(int32_t int_data_1, int32_t int_data_2, const std::function<void(UObject*)>& callable) -> void
     {
-        if (int_data_2 > s_name_search_results.size())
+        // Copied so that the lock isn't held while calling out, the delete listener would be stuck waiting for it
+        std::vector<UObject*> search_results{};
         {
-            Output::send<LogLevel::Error>(STR("guobjectarray_by_name_iterator: asked to iterate beyond the size of the search result vector ({} > {})\n"),
-                                          int_data_2,
-                                          s_name_search_results.size());
-            return;
+            std::lock_guard lock{s_name_search_results_mutex};
+            compact_search_results();
+            if (int_data_2 > s_name_search_results.size())
+            {
+                Output::send<LogLevel::Error>(STR("guobjectarray_by_name_iterator: asked to iterate beyond the size of the search result vector ({} > {})\n"),
+                                              int_data_2,
+                                              s_name_search_results.size());
+                return;
+            }
+            search_results.assign(s_name_search_results.begin() + int_data_1, s_name_search_results.begin() + int_data_2);
         }
-        for (size_t i = int_data_1; i < int_data_2; i++)
+        for (auto* search_result : search_results)
         {
-            callable(s_name_search_results[i]);
+            callable(search_result);
         }
     }
 
@@ -967,10 +1084,30 @@ namespace RC::GUI
         {
             Output::send(STR("Searching by name...\n"));
         }
-        s_name_search_results.clear();
-        s_name_search_results_set.clear();
+        {
+            std::lock_guard lock{s_name_search_results_mutex};
+            s_name_search_results.clear();
+            s_name_search_result_indices.clear();
+            s_first_removed_search_result_index = std::numeric_limits<size_t>::max();
+        }
         Filter::s_highlighted_properties.clear();
 
+        if (!ignore_name)
+        {
+            try
+            {
+                s_name_search_matcher.build(s_name_to_search_by, s_use_regex_for_search);
+            }
+            catch (std::exception& e)
+            {
+                UE4SS_ERROR_OUTPUTTER()
+                s_name_to_search_by.clear();
+                set_is_searching_by_name(false);
+                set_search_field_clear_requested(true);
+                return;
+            }
+        }
+
         uintptr_t address_to_search_by = 0;
         if (LiveView::s_search_by_address && !ignore_name)
         {
@@ -988,8 +1125,9 @@ namespace RC::GUI
             }
         }
 
+        std::unordered_map<UStruct*, bool> inheritance_matches{};
         UObjectGlobals::ForEachUObject([&](UObject* object, ...) {
-            const auto was_added = attempt_to_add_search_result(object, ignore_name);
+            const auto was_added = attempt_to_add_search_result(object, ignore_name, &inheritance_matches);
 #if RC_LIVE_VIEW_DEBUG_FILTER_RESULTS
             if (ignore_name)
             {
@@ -3242,7 +3380,13 @@ namespace RC::GUI
         {
             StringType result{};
             auto is_below_425 = Version::IsBelow(4, 25);
-            for (const auto& search_result : s_name_search_results)
+            std::vector<UObject*> search_results{};
+            {
+                std::lock_guard lock{s_name_search_results_mutex};
+                compact_search_results();
+                search_results = s_name_search_results;
+            }
+            for (const auto& search_result : search_results)
             {
                 UE4SSProgram::dump_uobject(search_result, nullptr, result, is_below_425);
             }
@@ -3352,6 +3496,8 @@ namespace RC::GUI
         {
             // If we are searching by name, presumably `s_name_search_results`
             // already holds only valid objects.
+            std::lock_guard lock{s_name_search_results_mutex};
+            compact_search_results();
             objects_to_draw = s_name_search_results;
         }
         else
@@ -1,110 +1,10 @@
 #include <GUI/LuaDebugger.hpp>
 
-// Check if we're using Luau (which has incompatible debug API)
 #include <lua.hpp>
 
-#ifdef USING_LUAU
-// Luau's debug API is fundamentally different from Lua 5.x
-// The LuaDebugger requires the following which Luau doesn't support:
-// - lua_getstack / lua_getinfo with 3 arguments
-// - lua_Debug::namewhat, event fields
-// - lua_getlocal with lua_Debug* parameter
-// For now, we provide a stub implementation when using Luau
-// TODO: Rewrite LuaDebugger to use Luau's debug API (lua_callbacks, etc.)
-
-#include <DynamicOutput/DynamicOutput.hpp>
-
-namespace RC::GUI
-{
-    LuaDebugger* LuaDebugger::s_instance = nullptr;
-
-    LuaDebugger::LuaDebugger()
-    {
-        if (!s_instance)
-        {
-            s_instance = this;
-        }
-    }
-
-    LuaDebugger::~LuaDebugger()
-    {
-        if (s_instance == this)
-        {
-            s_instance = nullptr;
-        }
-    }
-
-    auto LuaDebugger::get() -> LuaDebugger&
-    {
-        static LuaDebugger instance;
-        return instance;
-    }
-
-    auto LuaDebugger::has_instance() -> bool { return s_instance != nullptr; }
-
-    // State tracking - stubs
-    auto LuaDebugger::register_lua_state(lua_State*, const std::string&, const std::string&) -> void {}
-    auto LuaDebugger::unregister_lua_state(lua_State*) -> void {}
-    auto LuaDebugger::update_state_stack(lua_State*) -> void {}
-
-    // Error recording - stubs
-    auto LuaDebugger::record_error(lua_State*, const std::string&, const std::string&) -> void {}
-    auto LuaDebugger::clear_error_history() -> void {}
-    auto LuaDebugger::get_error_count() const -> size_t { return 0; }
-
-    // Stack inspection utilities - stubs
-    auto LuaDebugger::get_stack_slots(lua_State*) -> std::vector<LuaStackSlot> { return {}; }
-    auto LuaDebugger::get_call_stack(lua_State*) -> std::vector<LuaCallStackEntry> { return {}; }
-    auto LuaDebugger::get_stack_frames_with_locals(lua_State*) -> std::vector<LuaStackFrame> { return {}; }
-    auto LuaDebugger::format_stack_value(lua_State*, int, size_t) -> std::string { return ""; }
-    auto LuaDebugger::get_enhanced_traceback(lua_State*, const std::string& message, int) -> std::string { return message; }
-    auto LuaDebugger::get_globals(lua_State*, size_t) -> std::vector<std::pair<std::string, LuaStackSlot>> { return {}; }
-
-    // Breakpoint management - stubs
-    auto LuaDebugger::add_breakpoint(const std::string&, int, const std::string&) -> void {}
-    auto LuaDebugger::remove_breakpoint(const std::string&, int) -> void {}
-    auto LuaDebugger::toggle_breakpoint(const std::string&, int) -> void {}
-    auto LuaDebugger::clear_all_breakpoints() -> void {}
-    auto LuaDebugger::has_breakpoint(const std::string&, int) const -> bool { return false; }
-
-    // Debug control - stubs
-    auto LuaDebugger::continue_execution() -> void {}
-    auto LuaDebugger::step_into() -> void {}
-    auto LuaDebugger::step_over() -> void {}
-    auto LuaDebugger::step_out() -> void {}
-
-    // Debug hook - stubs
-    auto LuaDebugger::debug_hook(lua_State*, lua_Debug*) -> void {}
-    auto LuaDebugger::install_debug_hook(lua_State*) -> void {}
-    auto LuaDebugger::uninstall_debug_hook(lua_State*) -> void {}
-    auto LuaDebugger::has_debug_hook(lua_State*) const -> bool { return false; }
-
-    // Script loading - stubs
-    auto LuaDebugger::load_script(const std::string&) -> const LuaScriptFile* { return nullptr; }
-    auto LuaDebugger::get_mod_scripts(lua_State*) -> std::vector<std::string> { return {}; }
-    auto LuaDebugger::save_script(const std::string&, const std::string&) -> bool { return false; }
-    auto LuaDebugger::reload_mod_for_state(lua_State*) -> void {}
-
-    // REPL - stubs
-    auto LuaDebugger::execute_repl(lua_State*, const std::string&) -> void {}
-
-    // Table inspection - stubs
-    auto LuaDebugger::get_table_children(lua_State*, const std::string&, int) -> std::vector<LuaValueNode> { return {}; }
-    auto LuaDebugger::request_table_expand(const std::string&) -> void {}
-
-    // GUI rendering - stub
-    auto LuaDebugger::render() -> void
-    {
-        // Stub implementation - Lua debugger not available with Luau
-        // TODO: Implement using Luau's debug API
-    }
-
-} // namespace RC::GUI
-
-#else // Not using Luau - use full implementation
-
 #include <algorithm>
 #include <bit>
+#include <cctype>
 #include <ctime>
 #include <filesystem>
 #include <fstream>
@@ -256,6 +156,7 @@ namespace RC::GUI
     {
         s_instance = this;
         LuaMadeSimple::register_error_callback(lua_error_callback);
+        LuauCompat::s_chunk_loaded_callback.store(on_chunk_loaded);
         m_script_editor.SetLanguageDefinition(TextEditor::LanguageDefinition::Lua());
         m_script_editor.SetShowWhitespaces(false);
     }
@@ -263,6 +164,7 @@ namespace RC::GUI
     LuaDebugger::~LuaDebugger()
     {
         LuaMadeSimple::unregister_error_callback(lua_error_callback);
+        LuauCompat::s_chunk_loaded_callback.store(nullptr);
 
         if (s_instance == this)
         {
@@ -283,15 +185,17 @@ namespace RC::GUI
 
     auto LuaDebugger::register_lua_state(lua_State* L, const std::string& mod_name, const std::string& state_type) -> void
     {
-        std::lock_guard<std::mutex> lock(m_states_mutex);
+        {
+            std::lock_guard<std::mutex> lock(m_states_mutex);
 
-        LuaStateInfo info;
-        info.lua_state = L;
-        info.mod_name = mod_name;
-        info.state_type = state_type;
-        info.is_active = true;
+            LuaStateInfo info;
+            info.lua_state = L;
+            info.mod_name = mod_name;
+            info.state_type = state_type;
+            info.is_active = true;
 
-        m_lua_states[L] = std::move(info);
+            m_lua_states[L] = std::move(info);
+        }
 
         // Auto-restore debug hook if this mod had debug enabled before reload
         if (m_debug_enabled_mods.count(mod_name) > 0)
@@ -412,11 +316,11 @@ namespace RC::GUI
         }
 
         lua_Debug ar;
-        int level = 0;
+        const int stack_depth = lua_stackdepth(L);
 
-        while (lua_getstack(L, level, &ar))
+        for (int level = 0; level < stack_depth; ++level)
         {
-            if (lua_getinfo(L, "Slntu", &ar))
+            if (lua_getinfo(L, level, "sln", &ar))
             {
                 LuaCallStackEntry entry;
 
@@ -441,11 +345,10 @@ namespace RC::GUI
                 entry.line_number = ar.linedefined;
                 entry.current_line = ar.currentline;
                 entry.what = ar.what ? ar.what : "";
-                entry.name_what = ar.namewhat ? ar.namewhat : "";
+                // Luau doesn't track how a function was reached so 'name_what' is always empty
 
                 stack.push_back(std::move(entry));
             }
-            ++level;
         }
 
         return stack;
@@ -461,11 +364,11 @@ namespace RC::GUI
         }
 
         lua_Debug ar;
-        int level = 0;
+        const int stack_depth = lua_stackdepth(L);
 
-        while (lua_getstack(L, level, &ar))
+        for (int level = 0; level < stack_depth; ++level)
         {
-            if (lua_getinfo(L, "Slntu", &ar))
+            if (lua_getinfo(L, level, "sln", &ar))
             {
                 LuaStackFrame frame;
                 frame.function_name = ar.name ? ar.name : "(anonymous)";
@@ -486,7 +389,7 @@ namespace RC::GUI
                 // during the debug hook. format_stack_value pushes/pops which can cause crashes.
                 int local_index = 1;
                 const char* local_name;
-                while ((local_name = lua_getlocal(L, &ar, local_index)) != nullptr)
+                while ((local_name = lua_getlocal(L, level, local_index)) != nullptr)
                 {
                     LuaLocalVariable local;
                     local.name = local_name;
@@ -502,7 +405,6 @@ namespace RC::GUI
 
                 frames.push_back(std::move(frame));
             }
-            ++level;
         }
 
         return frames;
@@ -733,7 +635,9 @@ namespace RC::GUI
         case LUA_TFUNCTION: {
             lua_Debug ar;
             lua_pushvalue(L, index);
-            if (lua_getinfo(L, ">S", &ar))
+            const bool has_info = lua_getinfo(L, -1, "s", &ar);
+            lua_pop(L, 1);
+            if (has_info)
             {
                 if (ar.what && strcmp(ar.what, "C") == 0)
                 {
@@ -833,11 +737,11 @@ namespace RC::GUI
         oss << message << "\n\nCall Stack:\n";
 
         lua_Debug ar;
-        int current_level = level;
+        const int stack_depth = lua_stackdepth(L);
 
-        while (lua_getstack(L, current_level, &ar))
+        for (int current_level = level; current_level < stack_depth; ++current_level)
         {
-            if (lua_getinfo(L, "Slntu", &ar))
+            if (lua_getinfo(L, current_level, "sln", &ar))
             {
                 oss << "  [" << current_level << "] ";
 
@@ -845,10 +749,6 @@ namespace RC::GUI
                 if (ar.name)
                 {
                     oss << ar.name;
-                    if (ar.namewhat && ar.namewhat[0])
-                    {
-                        oss << " (" << ar.namewhat << ")";
-                    }
                 }
                 else if (ar.what)
                 {
@@ -897,7 +797,6 @@ namespace RC::GUI
 
                 oss << "\n";
             }
-            ++current_level;
         }
 
         // Add stack snapshot
@@ -1137,65 +1036,123 @@ namespace RC::GUI
         m_tree_refresh_requested = true;
     }
 
-    auto LuaDebugger::add_breakpoint(const std::string& source, int line, const std::string& condition) -> void
+    auto LuaDebugger::normalize_chunk_name(std::string_view chunk_name) -> std::string
     {
-        std::lock_guard<std::mutex> lock(m_breakpoints_mutex);
+        if (!chunk_name.empty() && chunk_name.front() == '@')
+        {
+            chunk_name.remove_prefix(1);
+        }
 
-        for (auto& bp : m_breakpoints)
+        // Paths are case-insensitive on Windows & mods build them with either kind of separator
+        std::string normalized;
+        normalized.reserve(chunk_name.size());
+        for (char c : chunk_name)
+        {
+            if (c == '\\')
+            {
+                c = '/';
+            }
+            if (c == '/' && !normalized.empty() && normalized.back() == '/')
+            {
+                continue;
+            }
+            normalized.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+        }
+        return normalized;
+    }
+
+    auto LuaDebugger::rebuild_breakpoint_index() -> void
+    {
+        // Caller must hold 'm_breakpoints_mutex'
+        m_breakpoint_index.clear();
+        for (const auto& bp : m_breakpoints)
         {
-            if (bp.source_file == source && bp.line == line)
+            if (bp.enabled)
             {
+                m_breakpoint_index[bp.chunk_name].insert(bp.line);
+            }
+        }
+    }
+
+    auto LuaDebugger::add_breakpoint(const std::string& source, int line, const std::string& condition) -> void
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_breakpoints_mutex);
+
+            auto it = std::find_if(m_breakpoints.begin(), m_breakpoints.end(), [&](const LuaBreakpoint& bp) {
+                return bp.source_file == source && bp.line == line;
+            });
+            if (it != m_breakpoints.end())
+            {
+                it->condition = condition;
+                it->enabled = true;
+            }
+            else
+            {
+                LuaBreakpoint bp;
+                bp.source_file = source;
+                bp.chunk_name = normalize_chunk_name(source);
+                bp.line = line;
                 bp.condition = condition;
                 bp.enabled = true;
-                return;
+                m_breakpoints.push_back(std::move(bp));
             }
+            rebuild_breakpoint_index();
         }
-
-        LuaBreakpoint bp;
-        bp.source_file = source;
-        bp.line = line;
-        bp.condition = condition;
-        bp.enabled = true;
-        m_breakpoints.push_back(std::move(bp));
+        request_breakpoint_sync();
     }
 
     auto LuaDebugger::remove_breakpoint(const std::string& source, int line) -> void
     {
-        std::lock_guard<std::mutex> lock(m_breakpoints_mutex);
+        {
+            std::lock_guard<std::mutex> lock(m_breakpoints_mutex);
 
-        m_breakpoints.erase(
-                std::remove_if(m_breakpoints.begin(),
-                               m_breakpoints.end(),
-                               [&](const LuaBreakpoint& bp) {
-                                   return bp.source_file == source && bp.line == line;
-                               }),
-                m_breakpoints.end());
+            m_breakpoints.erase(
+                    std::remove_if(m_breakpoints.begin(),
+                                   m_breakpoints.end(),
+                                   [&](const LuaBreakpoint& bp) {
+                                       return bp.source_file == source && bp.line == line;
+                                   }),
+                    m_breakpoints.end());
+            rebuild_breakpoint_index();
+        }
+        request_breakpoint_sync();
     }
 
     auto LuaDebugger::toggle_breakpoint(const std::string& source, int line) -> void
     {
-        std::lock_guard<std::mutex> lock(m_breakpoints_mutex);
-
-        for (auto& bp : m_breakpoints)
         {
-            if (bp.source_file == source && bp.line == line)
+            std::lock_guard<std::mutex> lock(m_breakpoints_mutex);
+
+            auto it = std::find_if(m_breakpoints.begin(), m_breakpoints.end(), [&](const LuaBreakpoint& bp) {
+                return bp.source_file == source && bp.line == line;
+            });
+            if (it != m_breakpoints.end())
             {
-                bp.enabled = !bp.enabled;
-                return;
+                it->enabled = !it->enabled;
+            }
+            else
+            {
+                LuaBreakpoint bp;
+                bp.source_file = source;
+                bp.chunk_name = normalize_chunk_name(source);
+                bp.line = line;
+                bp.enabled = true;
+                m_breakpoints.push_back(std::move(bp));
             }
+            rebuild_breakpoint_index();
         }
-
-        LuaBreakpoint bp;
-        bp.source_file = source;
-        bp.line = line;
-        bp.enabled = true;
-        m_breakpoints.push_back(std::move(bp));
+        request_breakpoint_sync();
     }
 
     auto LuaDebugger::clear_all_breakpoints() -> void
     {
-        std::lock_guard<std::mutex> lock(m_breakpoints_mutex);
-        m_breakpoints.clear();
+        {
+            std::lock_guard<std::mutex> lock(m_breakpoints_mutex);
+            m_breakpoints.clear();
+            rebuild_breakpoint_index();
+        }
+        request_breakpoint_sync();
     }
 
     auto LuaDebugger::has_breakpoint(const std::string& source, int line) const -> bool
@@ -1248,46 +1205,47 @@ namespace RC::GUI
         m_pause_cv.notify_all();
     }
 
-    auto LuaDebugger::get_call_depth(lua_State* L) -> int
-    {
-        int depth = 0;
-        lua_Debug ar;
-        while (lua_getstack(L, depth, &ar))
-        {
-            ++depth;
-        }
-        return depth;
-    }
-
-    auto LuaDebugger::check_breakpoint(lua_State* L, lua_Debug* ar) -> bool
+    auto LuaDebugger::is_breakpoint_hit(lua_State* L, lua_Debug* ar) -> bool
     {
+        // Only called when a patched instruction is reached, lines without breakpoints never get here
         if (!ar->source)
         {
             return false;
         }
 
-        std::string source = ar->source;
-        if (!source.empty() && source[0] == '@')
+        const std::string chunk_name = normalize_chunk_name(ar->source);
+        int requested_line = ar->currentline;
         {
-            source = source.substr(1);
+            std::lock_guard<std::mutex> lock(m_patched_breakpoints_mutex);
+            if (auto state_it = m_patched_breakpoints.find(lua_mainthread(L)); state_it != m_patched_breakpoints.end())
+            {
+                if (auto chunk_it = state_it->second.find(chunk_name); chunk_it != state_it->second.end())
+                {
+                    if (auto line_it = chunk_it->second.find(ar->currentline); line_it != chunk_it->second.end())
+                    {
+                        requested_line = line_it->second;
+                    }
+                }
+            }
         }
 
+        // The breakpoint may have been removed or disabled since the bytecode was last synced
         std::lock_guard<std::mutex> lock(m_breakpoints_mutex);
+        auto index_it = m_breakpoint_index.find(chunk_name);
+        if (index_it == m_breakpoint_index.end() || !index_it->second.contains(requested_line))
+        {
+            return false;
+        }
 
         for (auto& bp : m_breakpoints)
         {
-            if (bp.enabled && ar->currentline == bp.line)
+            if (bp.enabled && bp.line == requested_line && bp.chunk_name == chunk_name)
             {
-                // Check if source matches (partial match for paths)
-                if (source.find(bp.source_file) != std::string::npos ||
-                    bp.source_file.find(source) != std::string::npos)
-                {
-                    ++bp.hit_count;
-                    return true;
-                }
+                ++bp.hit_count;
+                break;
             }
         }
-        return false;
+        return true;
     }
 
     auto LuaDebugger::wait_for_continue() -> void
@@ -1302,7 +1260,94 @@ namespace RC::GUI
                         });
     }
 
-    auto LuaDebugger::debug_hook(lua_State* L, lua_Debug* ar) -> void
+    auto LuaDebugger::is_step_complete(lua_State* L, lua_Debug* ar) -> bool
+    {
+        if (m_stepping_state != lua_mainthread(L))
+        {
+            return false;
+        }
+
+        const int current_depth = lua_stackdepth(L);
+        const bool is_new_line = ar->currentline != m_step_start_line;
+
+        if (m_step_requested.load())
+        {
+            return is_new_line || current_depth != m_step_start_depth;
+        }
+        if (m_step_over_requested.load())
+        {
+            return current_depth < m_step_start_depth || (current_depth == m_step_start_depth && is_new_line);
+        }
+        if (m_step_out_requested.load())
+        {
+            return current_depth < m_step_start_depth;
+        }
+        return false;
+    }
+
+    auto LuaDebugger::pause_execution(lua_State* L, lua_Debug* ar) -> void
+    {
+        m_paused_state = L;
+        m_paused_line = ar->currentline;
+        m_paused_source = ar->source ? ar->source : "";
+        m_step_start_depth = lua_stackdepth(L);
+        m_step_start_line = ar->currentline;
+        m_script_scroll_to_line = ar->currentline;
+
+        {
+            std::lock_guard<std::mutex> lock(m_paused_data_mutex);
+            m_paused_stack_slots = get_stack_slots(L);
+            m_paused_call_stack = get_call_stack(L);
+            m_paused_stack_frames = get_stack_frames_with_locals(L);
+        }
+
+        m_is_paused.store(true);
+        m_continue_requested.store(false);
+        wait_for_continue();
+        m_is_paused.store(false);
+        m_paused_state = nullptr;
+
+        {
+            std::lock_guard<std::mutex> lock(m_paused_data_mutex);
+            m_paused_stack_slots.clear();
+            m_paused_call_stack.clear();
+            m_paused_stack_frames.clear();
+        }
+
+        // Luau only enters single step mode when the VM is entered, not in the middle of a call
+        // Steps are instead done by patching every line of the functions a step can end up in
+        // Those patches stay in place until execution continues normally, so each step only patches functions it hasn't patched yet
+        const bool is_stepping = m_step_requested.load() || m_step_over_requested.load() || m_step_out_requested.load();
+        lua_State* main_thread = lua_mainthread(L);
+        if (m_stepping_state && (!is_stepping || m_stepping_state != main_thread))
+        {
+            if (m_stepping_state == main_thread)
+            {
+                set_step_breakpoints(L, false);
+            }
+            else
+            {
+                // The other state can be running on another thread, so it has to remove its patches itself
+                {
+                    std::lock_guard<std::mutex> lock(m_patched_breakpoints_mutex);
+                    m_pending_step_cleanup.insert(m_stepping_state);
+                }
+                lua_callbacks(m_stepping_state)->interrupt = on_interrupt;
+            }
+            m_stepping_state = nullptr;
+        }
+        if (is_stepping)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_patched_breakpoints_mutex);
+                m_pending_step_cleanup.erase(main_thread);
+            }
+            set_step_breakpoints(L, true);
+            m_stepping_state = main_thread;
+        }
+    }
+
+    auto LuaDebugger::debug_break(lua_State* L, lua_Debug* ar) -> void
     {
         if (!has_instance())
         {
@@ -1310,94 +1355,335 @@ namespace RC::GUI
         }
 
         auto& debugger = get();
+        if (!debugger.has_debug_hook(L))
+        {
+            return;
+        }
 
-        // Get debug info
-        lua_getinfo(L, "Slnu", ar);
+        lua_getinfo(L, 0, "sl", ar);
 
-        // Check for breakpoint
-        bool should_break = false;
+        if (debugger.is_step_complete(L, ar))
+        {
+            debugger.m_step_requested.store(false);
+            debugger.m_step_over_requested.store(false);
+            debugger.m_step_out_requested.store(false);
+            debugger.pause_execution(L, ar);
+        }
+        else if (debugger.is_breakpoint_hit(L, ar))
+        {
+            debugger.pause_execution(L, ar);
+        }
+    }
 
-        if (ar->event == LUA_HOOKLINE)
+    auto LuaDebugger::on_chunk_loaded(lua_State* L) -> void
+    {
+        if (has_instance())
         {
-            if (debugger.check_breakpoint(L, ar))
+            get().sync_breakpoints(L);
+        }
+    }
+
+    auto LuaDebugger::on_interrupt(lua_State* L, int gc) -> void
+    {
+        // Also called during garbage collection, the state can't be changed then
+        if (gc >= 0)
+        {
+            return;
+        }
+
+        // Cleared before syncing, a sync requested while this one runs sets it again
+        lua_callbacks(L)->interrupt = nullptr;
+        if (!has_instance())
+        {
+            return;
+        }
+
+        auto& debugger = get();
+        bool has_pending_step_cleanup{};
+        {
+            std::lock_guard<std::mutex> lock(debugger.m_patched_breakpoints_mutex);
+            has_pending_step_cleanup = debugger.m_pending_step_cleanup.erase(lua_mainthread(L)) > 0;
+        }
+
+        if (has_pending_step_cleanup)
+        {
+            // Also patches the real breakpoints in again
+            debugger.set_step_breakpoints(L, false);
+        }
+        else
+        {
+            debugger.sync_breakpoints(L);
+        }
+    }
+
+    // Sets or clears a breakpoint in every function in the chunk list at the top of the stack
+    // Returns the first line a breakpoint was actually placed on, or -1 if the chunks have no code at or after 'line'
+    static auto set_chunk_breakpoint(lua_State* L, int line, bool enabled) -> int
+    {
+        int actual_line = -1;
+        const int num_chunks = lua_objlen(L, -1);
+        for (int i = 1; i <= num_chunks; ++i)
+        {
+            lua_rawgeti(L, -1, i);
+            if (lua_isLfunction(L, -1))
             {
-                should_break = true;
+                const int chunk_line = lua_breakpoint(L, -1, line, enabled);
+                if (chunk_line != -1 && (actual_line == -1 || chunk_line < actual_line))
+                {
+                    actual_line = chunk_line;
+                }
             }
-            
-            if (debugger.m_step_requested.load())
+            lua_pop(L, 1);
+        }
+        return actual_line;
+    }
+
+    // Set of functions that have every line patched while stepping, they stay patched until execution continues normally
+    constexpr static const char* step_functions_registry_key = "ue4ss_debugger_step_functions";
+
+    // Sets or clears a breakpoint on every line of the function at the top of the stack, including nested functions
+    static auto set_function_step_breakpoints(lua_State* L, bool enabled) -> void
+    {
+        lua_Debug ar{};
+        lua_getinfo(L, -1, "s", &ar);
+
+        // lua_breakpoint skips ahead to the next line with code, so this only visits lines that can be stepped to
+        for (int line = std::max(ar.linedefined, 1); (line = lua_breakpoint(L, -1, line, enabled)) != -1; ++line)
+        {
+        }
+    }
+
+    // Patches every line of the function at the top of the stack unless it's already in the step function set at 'set_index'
+    // Pops the function
+    static auto add_step_function(lua_State* L, int set_index) -> void
+    {
+        if (lua_isLfunction(L, -1))
+        {
+            lua_pushvalue(L, -1);
+            lua_rawget(L, set_index);
+            const bool is_patched = lua_toboolean(L, -1);
+            lua_pop(L, 1);
+
+            if (!is_patched)
+            {
+                set_function_step_breakpoints(L, true);
+                lua_pushvalue(L, -1);
+                lua_pushboolean(L, true);
+                lua_rawset(L, set_index);
+            }
+        }
+        lua_pop(L, 1);
+    }
+
+    auto LuaDebugger::set_step_breakpoints(lua_State* L, bool enabled) -> void
+    {
+        // Must be called from the thread that runs 'L', same as 'sync_breakpoints'
+        if (!lua_checkstack(L, 8))
+        {
+            return;
+        }
+
+        if (enabled)
+        {
+            lua_getfield(L, LUA_REGISTRYINDEX, step_functions_registry_key);
+            if (!lua_istable(L, -1))
             {
-                should_break = true;
-                debugger.m_step_requested.store(false);
+                lua_pop(L, 1);
+                lua_newtable(L);
+                lua_pushvalue(L, -1);
+                lua_setfield(L, LUA_REGISTRYINDEX, step_functions_registry_key);
             }
+            const int step_functions = lua_gettop(L);
 
-            if (debugger.m_step_over_requested.load())
+            if (m_step_requested.load())
             {
-                int current_depth = debugger.get_call_depth(L);
-                if (current_depth <= debugger.m_step_start_depth)
+                // Stepping into a call can end up in any loaded chunk, chunks loaded since the last step are picked up here too
+                lua_getfield(L, LUA_REGISTRYINDEX, LuauCompat::LOADED_CHUNKS_REGISTRY_KEY);
+                if (lua_istable(L, -1))
                 {
-                    should_break = true;
-                    debugger.m_step_over_requested.store(false);
+                    lua_pushnil(L);
+                    while (lua_next(L, -2))
+                    {
+                        const int num_chunks = lua_istable(L, -1) ? lua_objlen(L, -1) : 0;
+                        for (int i = 1; i <= num_chunks; ++i)
+                        {
+                            lua_rawgeti(L, -1, i);
+                            add_step_function(L, step_functions);
+                        }
+                        lua_pop(L, 1);
+                    }
                 }
+                lua_pop(L, 1);
             }
-
-            if (debugger.m_step_out_requested.load())
+            else
             {
-                int current_depth = debugger.get_call_depth(L);
-                if (current_depth < debugger.m_step_start_depth)
+                // Stepping over or out of a call can only stop in a function that's already on the stack
+                lua_Debug ar{};
+                const int depth = lua_stackdepth(L);
+                for (int level = 0; level < depth; ++level)
                 {
-                    should_break = true;
-                    debugger.m_step_out_requested.store(false);
+                    if (lua_getinfo(L, level, "f", &ar))
+                    {
+                        add_step_function(L, step_functions);
+                    }
                 }
             }
+
+            lua_pop(L, 1);
+            return;
         }
 
-        if (should_break)
+        lua_getfield(L, LUA_REGISTRYINDEX, step_functions_registry_key);
+        if (lua_istable(L, -1))
         {
-            debugger.m_paused_state = L;
-            debugger.m_paused_line = ar->currentline;
-            debugger.m_paused_source = ar->source ? ar->source : "";
-            debugger.m_step_start_depth = debugger.get_call_depth(L);
-            debugger.m_script_scroll_to_line = ar->currentline;
-
+            lua_pushnil(L);
+            while (lua_next(L, -2))
             {
-                std::lock_guard<std::mutex> lock(debugger.m_paused_data_mutex);
-                debugger.m_paused_stack_slots = debugger.get_stack_slots(L);
-                debugger.m_paused_call_stack = debugger.get_call_stack(L);
-                debugger.m_paused_stack_frames = debugger.get_stack_frames_with_locals(L);
+                lua_pop(L, 1);
+                set_function_step_breakpoints(L, false);
             }
+        }
+        lua_pop(L, 1);
+        lua_pushnil(L);
+        lua_setfield(L, LUA_REGISTRYINDEX, step_functions_registry_key);
 
-            debugger.m_is_paused.store(true);
-            debugger.m_continue_requested.store(false);
-            debugger.wait_for_continue();
-            debugger.m_is_paused.store(false);
-            debugger.m_paused_state = nullptr;
+        // Clearing every line also cleared any real breakpoints on those lines, so they need to be patched in again
+        {
+            std::lock_guard<std::mutex> lock(m_patched_breakpoints_mutex);
+            m_patched_breakpoints.erase(lua_mainthread(L));
+        }
+        sync_breakpoints(L);
+    }
 
+    auto LuaDebugger::sync_breakpoints(lua_State* L) -> void
+    {
+        // Must be called from the thread that runs 'L', bytecode can't be patched while it's executing
+        if (!L)
+        {
+            return;
+        }
+
+        lua_State* main_thread = lua_mainthread(L);
+        const bool debug_enabled = has_debug_hook(main_thread);
+
+        std::unordered_map<std::string, std::set<int>> wanted_breakpoints;
+        if (debug_enabled)
+        {
+            std::lock_guard<std::mutex> lock(m_breakpoints_mutex);
+            wanted_breakpoints = m_breakpoint_index;
+        }
+
+        std::lock_guard<std::mutex> lock(m_patched_breakpoints_mutex);
+        if (!debug_enabled && !m_patched_breakpoints.contains(main_thread))
+        {
+            return;
+        }
+        auto& patched_breakpoints = m_patched_breakpoints[main_thread];
+
+        if (debug_enabled)
+        {
+            lua_callbacks(L)->debugbreak = debug_break;
+        }
+
+        if (!lua_checkstack(L, 4))
+        {
+            return;
+        }
+
+        lua_getfield(L, LUA_REGISTRYINDEX, LuauCompat::LOADED_CHUNKS_REGISTRY_KEY);
+        if (lua_istable(L, -1))
+        {
+            lua_pushnil(L);
+            while (lua_next(L, -2))
             {
-                std::lock_guard<std::mutex> lock(debugger.m_paused_data_mutex);
-                debugger.m_paused_stack_slots.clear();
-                debugger.m_paused_call_stack.clear();
-                debugger.m_paused_stack_frames.clear();
+                if (lua_type(L, -2) == LUA_TSTRING && lua_istable(L, -1))
+                {
+                    const std::string chunk_name = normalize_chunk_name(lua_tostring(L, -2));
+                    auto wanted_it = wanted_breakpoints.find(chunk_name);
+                    auto& patched_lines = patched_breakpoints[chunk_name];
+
+                    // Clear stale breakpoints first, two requested lines can end up on the same patched line
+                    for (auto it = patched_lines.begin(); it != patched_lines.end();)
+                    {
+                        if (wanted_it == wanted_breakpoints.end() || !wanted_it->second.contains(it->second))
+                        {
+                            set_chunk_breakpoint(L, it->second, false);
+                            it = patched_lines.erase(it);
+                        }
+                        else
+                        {
+                            ++it;
+                        }
+                    }
+
+                    if (wanted_it != wanted_breakpoints.end())
+                    {
+                        for (int line : wanted_it->second)
+                        {
+                            if (int actual_line = set_chunk_breakpoint(L, line, true); actual_line != -1)
+                            {
+                                patched_lines[actual_line] = line;
+                            }
+                        }
+                    }
+
+                    if (patched_lines.empty())
+                    {
+                        patched_breakpoints.erase(chunk_name);
+                    }
+                }
+                lua_pop(L, 1);
             }
         }
+        lua_pop(L, 1);
+
+        if (patched_breakpoints.empty() && !debug_enabled)
+        {
+            m_patched_breakpoints.erase(main_thread);
+        }
+    }
+
+    auto LuaDebugger::request_breakpoint_sync() -> void
+    {
+        // Bytecode can only be patched by the thread that runs the state, so each state is interrupted and patches itself
+        // States that aren't running anything right now pick up the changes the next time they're called
+        UE4SSProgram::get_program().queue_event([]() {
+            for (const auto& mod : UE4SSProgram::get_program().m_mods)
+            {
+                auto* lua_mod = dynamic_cast<LuaMod*>(mod.get());
+                if (lua_mod && lua_mod->is_started())
+                {
+                    lua_callbacks(lua_mod->get_lua_state())->interrupt = on_interrupt;
+                }
+            }
+        });
     }
 
     auto LuaDebugger::install_debug_hook(lua_State* L) -> void
     {
         if (!L) return;
-        lua_sethook(L, debug_hook, LUA_MASKLINE | LUA_MASKCALL | LUA_MASKRET, 0);
-        m_states_with_hooks.insert(L);
+        {
+            std::lock_guard<std::mutex> lock(m_states_mutex);
+            m_states_with_hooks.insert(lua_mainthread(L));
+        }
+        request_breakpoint_sync();
     }
 
     auto LuaDebugger::uninstall_debug_hook(lua_State* L) -> void
     {
         if (!L) return;
-        lua_sethook(L, nullptr, 0, 0);
-        m_states_with_hooks.erase(L);
+        {
+            std::lock_guard<std::mutex> lock(m_states_mutex);
+            m_states_with_hooks.erase(lua_mainthread(L));
+        }
+        request_breakpoint_sync();
     }
 
     auto LuaDebugger::has_debug_hook(lua_State* L) const -> bool
     {
-        return m_states_with_hooks.count(L) > 0;
+        if (!L) return false;
+        std::lock_guard<std::mutex> lock(m_states_mutex);
+        return m_states_with_hooks.contains(lua_mainthread(L));
     }
 
     auto LuaDebugger::load_script(const std::string& path) -> const LuaScriptFile*
@@ -3111,60 +3397,78 @@ namespace RC::GUI
 
     auto LuaDebugger::render_breakpoints_panel() -> void
     {
-        std::lock_guard<std::mutex> lock(m_breakpoints_mutex);
-
-        if (m_breakpoints.empty())
-        {
-            ImGui::TextDisabled("No breakpoints set");
-            ImGui::TextDisabled("Click line numbers in");
-            ImGui::TextDisabled("Script view to add");
-            return;
-        }
-
-        if (ImGui::Button(ICON_FA_TRASH " Clear All"))
-        {
-            // Can't call clear_all_breakpoints here due to mutex, just clear directly
-            m_breakpoints.clear();
-        }
-
-        ImGui::Separator();
-
-        for (size_t i = 0; i < m_breakpoints.size(); ++i)
+        bool breakpoints_changed{};
         {
-            auto& bp = m_breakpoints[i];
+            std::lock_guard<std::mutex> lock(m_breakpoints_mutex);
 
-            ImGui::PushID(static_cast<int>(i));
-
-            // Checkbox to enable/disable
-            ImGui::Checkbox("##enabled", &bp.enabled);
-            ImGui::SameLine();
+            if (m_breakpoints.empty())
+            {
+                ImGui::TextDisabled("No breakpoints set");
+                ImGui::TextDisabled("Click line numbers in");
+                ImGui::TextDisabled("Script view to add");
+                return;
+            }
 
-            // Shorten source path
-            std::string short_source = bp.source_file;
-            if (short_source.length() > 20)
+            if (ImGui::Button(ICON_FA_TRASH " Clear All"))
             {
-                short_source = "..." + short_source.substr(short_source.length() - 17);
+                // Can't call clear_all_breakpoints here due to mutex, just clear directly
+                m_breakpoints.clear();
+                breakpoints_changed = true;
             }
 
-            ImGui::Text("%s:%d", short_source.c_str(), bp.line);
+            ImGui::Separator();
 
-            // Show hit count
-            if (bp.hit_count > 0)
+            for (size_t i = 0; i < m_breakpoints.size(); ++i)
             {
+                auto& bp = m_breakpoints[i];
+
+                ImGui::PushID(static_cast<int>(i));
+
+                // Checkbox to enable/disable
+                if (ImGui::Checkbox("##enabled", &bp.enabled))
+                {
+                    breakpoints_changed = true;
+                }
                 ImGui::SameLine();
-                ImGui::TextDisabled("(%d hits)", bp.hit_count);
+
+                // Shorten source path
+                std::string short_source = bp.source_file;
+                if (short_source.length() > 20)
+                {
+                    short_source = "..." + short_source.substr(short_source.length() - 17);
+                }
+
+                ImGui::Text("%s:%d", short_source.c_str(), bp.line);
+
+                // Show hit count
+                if (bp.hit_count > 0)
+                {
+                    ImGui::SameLine();
+                    ImGui::TextDisabled("(%d hits)", bp.hit_count);
+                }
+
+                // Delete button
+                ImGui::SameLine(ImGui::GetContentRegionAvail().x - 20);
+                if (ImGui::SmallButton(ICON_FA_TIMES))
+                {
+                    m_breakpoints.erase(m_breakpoints.begin() + i);
+                    breakpoints_changed = true;
+                    ImGui::PopID();
+                    break;
+                }
+
+                ImGui::PopID();
             }
 
-            // Delete button
-            ImGui::SameLine(ImGui::GetContentRegionAvail().x - 20);
-            if (ImGui::SmallButton(ICON_FA_TIMES))
+            if (breakpoints_changed)
             {
-                m_breakpoints.erase(m_breakpoints.begin() + i);
-                ImGui::PopID();
-                break;
+                rebuild_breakpoint_index();
             }
+        }
 
-            ImGui::PopID();
+        if (breakpoints_changed)
+        {
+            request_breakpoint_sync();
         }
     }
 
@@ -3195,7 +3499,7 @@ namespace RC::GUI
         }
         if (ImGui::IsItemHovered())
         {
-            ImGui::SetTooltip("Enable to allow breakpoints to pause execution");
+            ImGui::SetTooltip("Enable to allow breakpoints to pause execution\nScripts loaded before this tab was first opened need a mod restart");
         }
 
         ImGui::Separator();
@@ -4323,5 +4627,3 @@ namespace RC::GUI
     }
 
 } // namespace RC::GUI
-
-#endif // USING_LUAU
\ No newline at end of file
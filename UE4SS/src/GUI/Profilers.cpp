@@ -2,24 +2,264 @@
 
 #ifdef UE4SS_PROFILER_TAB
 
+#include <atomic>
+#include <chrono>
 #include <filesystem>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include <DynamicOutput/DynamicOutput.hpp>
 #include <ExceptionHandling.hpp>
 #include <Constructs/Loop.hpp>
+#include <LuaMadeSimple/LuaMadeSimple.hpp>
+#include <LuaType/LuaUObject.hpp>
 #include <UE4SSProgram.hpp>
 #include <Unreal/AActor.hpp>
 #include <Unreal/CoreUObject/UObject/Class.hpp>
+#include <Unreal/CoreUObject/UObject/UnrealType.hpp>
 #include <Unreal/Searcher/ObjectSearcher.hpp>
 #include <Unreal/Searcher/ObjectSearcherProfiler.hpp>
 #include <Unreal/UObjectGlobals.hpp>
 
 #include <imgui.h>
+#include <lua.hpp>
 
 namespace RC::GUI::Profilers
 {
     using namespace Unreal;
 
+    // Finds a UFunction without a return value that takes exactly 'num_params' params, none of them out params and all of them supported by Lua
+    static auto find_function_for_hook_benchmark(uint8 num_params) -> UFunction*
+    {
+        UFunction* found{};
+        UObjectGlobals::ForEachUObject([&](UObject* object, int32, int32) {
+            if (!object->IsA<UFunction>())
+            {
+                return LoopAction::Continue;
+            }
+            auto function = static_cast<UFunction*>(object);
+            if (function->GetNumParms() != num_params || function->GetReturnValueOffset() != 0xFFFF)
+            {
+                return LoopAction::Continue;
+            }
+            for (FProperty* param : TFieldRange<FProperty>(function, EFieldIterationFlags::IncludeDeprecated))
+            {
+                if (param->HasAnyPropertyFlags(EPropertyFlags::CPF_Parm) &&
+                    (param->HasAnyPropertyFlags(EPropertyFlags::CPF_OutParm) ||
+                     !LuaType::StaticState::m_property_value_pushers.find(param->GetClass().GetFName().GetComparisonIndex())))
+                {
+                    return LoopAction::Continue;
+                }
+            }
+            found = function;
+            return LoopAction::Break;
+        });
+        return found;
+    }
+
+    static auto empty_hook_callback(lua_State*) -> int
+    {
+        return 0;
+    }
+
+    // Times what a Lua hook does for every call of the hooked UFunction: push the callback, the context & every param into a lua_State, then call it.
+    // 'before' looks up the params & their pushers on every call like hooks used to, 'after' follows a marshalling plan the way hooks do now,
+    // i.e. one generation check & one atomic pointer load per call.
+    static auto benchmark_hook_param_marshalling() -> void
+    {
+        struct Step
+        {
+            FProperty* param;
+            LuaType::StaticState::PropertyValuePusherCallable pusher;
+            int32 offset;
+        };
+        struct Plan
+        {
+            uint8 num_params{};
+            std::vector<Step> steps{};
+        };
+
+        static auto s_object_property_name = FName(STR("ObjectProperty"), FNAME_Find);
+        constexpr int32 iterations = 100'000;
+
+        lua_State* lua_state = luaL_newstate();
+        {
+            LuaMadeSimple::Lua lua{lua_state};
+            for (const uint8 num_params : {uint8{0}, uint8{4}, uint8{12}})
+            {
+                auto function = find_function_for_hook_benchmark(num_params);
+                if (!function)
+                {
+                    Output::send<LogLevel::Warning>(STR("Hook marshalling benchmark: no UFunction with {} supported params found\n"), num_params);
+                    continue;
+                }
+
+                std::vector<uint8> params(function->GetPropertiesSize());
+                UObject* context = function;
+
+                auto start = std::chrono::steady_clock::now();
+                for (int32 i = 0; i < iterations; ++i)
+                {
+                    lua_pushcfunction(lua_state, empty_hook_callback);
+                    LuaType::RemoteUnrealParam::construct(lua, &context, s_object_property_name);
+                    for (FProperty* param : TFieldRange<FProperty>(function, EFieldIterationFlags::IncludeDeprecated))
+                    {
+                        if (!param->HasAnyPropertyFlags(EPropertyFlags::CPF_Parm))
+                        {
+                            continue;
+                        }
+                        auto pusher = LuaType::StaticState::m_property_value_pushers.find(param->GetClass().GetFName().GetComparisonIndex());
+                        pusher(LuaType::PusherParams{.operation = LuaType::Operation::GetParam,
+                                                     .lua = lua,
+                                                     .base = nullptr,
+                                                     .data = params.data() + param->GetOffset_Internal(),
+                                                     .property = param});
+                    }
+                    lua_call(lua_state, function->GetNumParms() + 1, 0);
+                }
+                const auto before_time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+                auto plan = std::make_unique<const Plan>([&] {
+                    Plan built{.num_params = function->GetNumParms()};
+                    for (FProperty* param : TFieldRange<FProperty>(function, EFieldIterationFlags::IncludeDeprecated))
+                    {
+                        if (param->HasAnyPropertyFlags(EPropertyFlags::CPF_Parm))
+                        {
+                            built.steps.emplace_back(Step{param,
+                                                          LuaType::StaticState::m_property_value_pushers.find(param->GetClass().GetFName().GetComparisonIndex()),
+                                                          param->GetOffset_Internal()});
+                        }
+                    }
+                    return built;
+                }());
+                std::atomic<const Plan*> published_plan{plan.get()};
+                std::atomic<uint32> plan_generation{};
+                std::atomic<uint32> current_generation{};
+
+                start = std::chrono::steady_clock::now();
+                for (int32 i = 0; i < iterations; ++i)
+                {
+                    if (plan_generation.load(std::memory_order_acquire) != current_generation.load(std::memory_order_relaxed))
+                    {
+                        plan_generation.store(current_generation.load(std::memory_order_relaxed), std::memory_order_release);
+                    }
+                    const auto& current_plan = *published_plan.load(std::memory_order_acquire);
+
+                    lua_pushcfunction(lua_state, empty_hook_callback);
+                    LuaType::RemoteUnrealParam::construct(lua, &context, s_object_property_name);
+                    for (const auto& step : current_plan.steps)
+                    {
+                        step.pusher(LuaType::PusherParams{.operation = LuaType::Operation::GetParam,
+                                                          .lua = lua,
+                                                          .base = nullptr,
+                                                          .data = params.data() + step.offset,
+                                                          .property = step.param});
+                    }
+                    lua_call(lua_state, current_plan.num_params + 1, 0);
+                }
+                const auto after_time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+                Output::send(STR("Hooked calls, {} calls of {} ({} params): before {:.2f} ms ({:.0f} ns/call), after {:.2f} ms ({:.0f} ns/call)\n"),
+                             iterations,
+                             function->GetName(),
+                             num_params,
+                             before_time,
+                             before_time * 1'000'000.0 / iterations,
+                             after_time,
+                             after_time * 1'000'000.0 / iterations);
+            }
+        }
+        lua_close(lua_state);
+    }
+
+    // Times pushing 1M int, float & object property values into a lua_State through the flat dispatch table,
+    // against looking each pusher up in the std::unordered_map of std::function that the table replaced and calling it through std::function.
+    static auto benchmark_property_pusher_lookup() -> void
+    {
+        std::unordered_map<int32, std::function<void(const LuaType::PusherParams&)>> map_pushers{};
+        for (FProperty* property : TFieldRange<FProperty>(AActor::StaticClass(), EFieldIterationFlags::IncludeSuper))
+        {
+            const auto type_index = static_cast<int32>(property->GetClass().GetFName().GetComparisonIndex());
+            if (auto pusher = LuaType::StaticState::m_property_value_pushers.find(type_index))
+            {
+                map_pushers.emplace(type_index, pusher);
+            }
+        }
+
+        auto find_actor_property = [](const FName type) -> FProperty* {
+            for (FProperty* property : TFieldRange<FProperty>(AActor::StaticClass(), EFieldIterationFlags::IncludeSuper))
+            {
+                if (property->GetClass().GetFName() == type)
+                {
+                    return property;
+                }
+            }
+            return nullptr;
+        };
+
+        int32 int_value{42};
+        float float_value{4.2f};
+        UObject* object_value = AActor::StaticClass();
+        const std::pair<FProperty*, void*> properties[] = {
+                {find_actor_property(FName(STR("IntProperty"), FNAME_Find)), &int_value},
+                {find_actor_property(FName(STR("FloatProperty"), FNAME_Find)), &float_value},
+                {find_actor_property(FName(STR("ObjectProperty"), FNAME_Find)), &object_value},
+        };
+
+        constexpr int32 iterations = 1'000'000;
+
+        lua_State* lua_state = luaL_newstate();
+        {
+            LuaMadeSimple::Lua lua{lua_state};
+            for (const auto& [property, data] : properties)
+            {
+                if (!property)
+                {
+                    Output::send<LogLevel::Warning>(STR("Pusher benchmark: AActor has no property of one of the benchmarked types\n"));
+                    continue;
+                }
+                const auto type_index = static_cast<int32>(property->GetClass().GetFName().GetComparisonIndex());
+                const LuaType::PusherParams pusher_params{.operation = LuaType::Operation::Get,
+                                                          .lua = lua,
+                                                          .base = nullptr,
+                                                          .data = data,
+                                                          .property = property};
+
+                auto start = std::chrono::steady_clock::now();
+                for (int32 i = 0; i < iterations; ++i)
+                {
+                    if (auto it = map_pushers.find(type_index); it != map_pushers.end() && it->second)
+                    {
+                        it->second(pusher_params);
+                    }
+                    lua_settop(lua_state, 0);
+                }
+                const auto map_time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+                start = std::chrono::steady_clock::now();
+                for (int32 i = 0; i < iterations; ++i)
+                {
+                    if (auto pusher = LuaType::StaticState::m_property_value_pushers.find(type_index))
+                    {
+                        pusher(pusher_params);
+                    }
+                    lua_settop(lua_state, 0);
+                }
+                const auto table_time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+                Output::send(STR("Push {} {}, {} pushes: unordered_map {:.2f} ms, dispatch table {:.2f} ms\n"),
+                             property->GetClass().GetFName().ToString(),
+                             property->GetName(),
+                             iterations,
+                             map_time,
+                             table_time);
+            }
+        }
+        lua_close(lua_state);
+    }
+
     auto render() -> void
     {
         ImGui::Text("Object Searcher Pool Profiler");
@@ -174,6 +414,22 @@ namespace RC::GUI::Profilers
                 Output::send(STR("ForEachUObject iterated {} objects\n"), count);
             });
         }
+
+        ImGui::Spacing();
+        ImGui::Text("=== Lua Hooks ===");
+        if (ImGui::Button("Test: Hook param marshalling"))
+        {
+            TRY([] {
+                benchmark_hook_param_marshalling();
+            });
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Test: Property pushers"))
+        {
+            TRY([] {
+                benchmark_property_pusher_lookup();
+            });
+        }
     }
 } // namespace RC::GUI::Profilers
 
@@ -1,6 +1,7 @@
 #include <bit>
 
 #include <LuaType/LuaCustomProperty.hpp>
+#include <LuaType/LuaUObject.hpp>
 #pragma warning(disable : 4005)
 #include <Unreal/CoreUObject/UObject/UnrealType.hpp>
 #include <Unreal/CoreUObject/UObject/Class.hpp>
@@ -19,11 +20,13 @@ namespace RC::LuaType
     auto LuaCustomProperty::PropertyList::add(StringType property_name, std::unique_ptr<Unreal::CustomProperty> property) -> void
     {
         (void)properties.emplace_back(LuaCustomProperty{property_name, std::move(property)}).m_property.get();
+        clear_property_lookup_cache();
     }
 
     auto LuaCustomProperty::PropertyList::clear() -> void
     {
         properties.clear();
+        clear_property_lookup_cache();
     }
 
     auto LuaCustomProperty::PropertyList::for_each(Unreal::UObject* base, const ForEachCallable& callable) -> bool
@@ -1,4 +1,6 @@
+#include <cstring>
 #include <format>
+#include <limits>
 
 #include <LuaType/LuaTArray.hpp>
 #include <LuaType/LuaUObject.hpp>
@@ -126,7 +128,7 @@ namespace RC::LuaType
             Unreal::FName property_type_name = lua_object.m_inner_property->GetClass().GetFName();
             int32_t name_comparison_index = property_type_name.GetComparisonIndex();
 
-            if (StaticState::m_property_value_pushers.contains(name_comparison_index))
+            if (auto pusher = StaticState::m_property_value_pushers.find(name_comparison_index))
             {
                 uint8_t* array_data = static_cast<uint8_t*>(lua_object.get_remote_cpp_object()->GetData());
 
@@ -149,7 +151,7 @@ namespace RC::LuaType
                                                      .base = lua_object.m_base,
                                                      .data = property_value,
                                                      .property = lua_object.m_inner_property};
-                    StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
+                    pusher(pusher_params);
 
                     // Call function passing index & the element, expecting 1 return value
                     // The element is read-only for all trivial types
@@ -181,6 +183,107 @@ namespace RC::LuaType
             return 0;
         });
 
+        // Converts every element in one pass, without calling into Lua for each one like 'ForEach' does
+        // The elements are the same values that indexing the array returns
+        table.add_pair("ToTable", [](const LuaMadeSimple::Lua& lua) -> int {
+            auto& lua_object = lua.get_userdata<TArray>();
+            if (!lua_object.get_remote_cpp_object() || !lua_object.m_inner_property)
+            {
+                lua.throw_error("[TArray:ToTable] The array is invalid.");
+            }
+
+            Unreal::FName property_type_name = lua_object.m_inner_property->GetClass().GetFName();
+            int32_t name_comparison_index = property_type_name.GetComparisonIndex();
+
+            auto pusher = StaticState::m_property_value_pushers.find(name_comparison_index);
+            if (!pusher)
+            {
+                lua.throw_error(fmt::format("[TArray:ToTable] Tried converting an array but the unreal property has no registered handler (via ArrayProperty). "
+                                            "Property type '{}' not supported.",
+                                            to_string(property_type_name.ToString())));
+            }
+
+            uint8_t* array_data = static_cast<uint8_t*>(lua_object.get_remote_cpp_object()->GetData());
+            int32_t array_size = lua_object.get_remote_cpp_object()->Num();
+
+            auto elements = lua.prepare_new_table(array_size);
+            for (int32_t i = 0; i < array_size; ++i)
+            {
+                elements.add_key(i + 1); // Adding 1 here to account for that fact that Lua tables are 1-indexed
+
+                const PusherParams pusher_params{.operation = LuaMadeSimple::Type::Operation::Get,
+                                                 .lua = lua,
+                                                 .base = lua_object.m_base,
+                                                 .data = array_data + (i * lua_object.m_inner_property->GetElementSize()),
+                                                 .property = lua_object.m_inner_property};
+                pusher(pusher_params);
+
+                elements.fuse_pair();
+            }
+
+            return 1;
+        });
+
+        table.add_pair("GetElementSize", [](const LuaMadeSimple::Lua& lua) -> int {
+            auto& lua_object = lua.get_userdata<TArray>();
+
+            lua.set_integer(lua_object.m_inner_property->GetElementSize());
+
+            return 1;
+        });
+
+        // Copies the memory of every element into a new Luau buffer, for arrays of plain data like numbers, FVector or FTransform
+        // Element 'n' starts at byte '(n - 1) * GetElementSize()', and the buffer doesn't see any changes made to the array afterwards
+        table.add_pair("ToBuffer", [](const LuaMadeSimple::Lua& lua) -> int {
+            auto& lua_object = lua.get_userdata<TArray>();
+            verify_inner_is_plain_old_data(lua, lua_object, "ToBuffer");
+
+            auto array = lua_object.get_remote_cpp_object();
+            const auto size = static_cast<size_t>(array->Num()) * static_cast<size_t>(lua_object.m_inner_property->GetElementSize());
+            void* buffer = lua_newbuffer(lua.get_lua_state(), size);
+            if (size > 0)
+            {
+                std::memcpy(buffer, array->GetData(), size);
+            }
+
+            return 1;
+        });
+
+        // Replaces the elements with the contents of a buffer laid out like the ones returned by 'ToBuffer'
+        table.add_pair("CopyFromBuffer", [](const LuaMadeSimple::Lua& lua) -> int {
+            auto& lua_object = lua.get_userdata<TArray>();
+            verify_inner_is_plain_old_data(lua, lua_object, "CopyFromBuffer");
+
+            size_t buffer_size{};
+            const void* buffer = lua_tobuffer(lua.get_lua_state(), 1, &buffer_size);
+            if (!buffer)
+            {
+                lua.throw_error("[TArray:CopyFromBuffer] Expected a buffer as the first parameter.");
+            }
+
+            const auto element_size = static_cast<size_t>(lua_object.m_inner_property->GetElementSize());
+            if (buffer_size % element_size != 0)
+            {
+                lua.throw_error(fmt::format("[TArray:CopyFromBuffer] The buffer size ({}) isn't a multiple of the element size ({}).", buffer_size, element_size));
+            }
+            const auto num = buffer_size / element_size;
+            if (num > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+            {
+                lua.throw_error("[TArray:CopyFromBuffer] The buffer has too many elements for a TArray.");
+            }
+
+            auto array = lua_object.get_remote_cpp_object();
+            const auto alignment = lua_object.m_inner_property->GetMinAlignment();
+            array->Empty(static_cast<int32_t>(num), static_cast<int32_t>(element_size), alignment);
+            if (num > 0)
+            {
+                array->AddZeroed(static_cast<int32_t>(num), static_cast<int32_t>(element_size), alignment);
+                std::memcpy(array->GetData(), buffer, buffer_size);
+            }
+
+            return 0;
+        });
+
         table.add_pair("IsValid", [](const LuaMadeSimple::Lua& lua) -> int {
             auto& lua_object = lua.get_userdata<TArray>();
 
@@ -211,7 +314,7 @@ namespace RC::LuaType
         Unreal::FName property_type_fname = lua_object.m_inner_property->GetClass().GetFName();
         int32_t name_comparison_index = property_type_fname.GetComparisonIndex();
 
-        if (StaticState::m_property_value_pushers.contains(name_comparison_index))
+        if (auto pusher = StaticState::m_property_value_pushers.find(name_comparison_index))
         {
             uint8_t* array_data = static_cast<uint8_t*>(array->GetData());
             void* property_value = array_data + (array_index * lua_object.m_inner_property->GetElementSize());
@@ -221,7 +324,7 @@ namespace RC::LuaType
                                              .base = lua_object.m_base,
                                              .data = property_value,
                                              .property = lua_object.m_inner_property};
-            StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
+            pusher(pusher_params);
         }
         else
         {
@@ -231,6 +334,24 @@ namespace RC::LuaType
         }
     }
 
+    auto TArray::verify_inner_is_plain_old_data(const LuaMadeSimple::Lua& lua, const TArray& lua_object, std::string_view function_name) -> void
+    {
+        if (!lua_object.get_remote_cpp_object() || !lua_object.m_inner_property)
+        {
+            lua.throw_error(fmt::format("[TArray:{}] The array is invalid.", function_name));
+        }
+
+        // Anything that owns memory (strings, nested arrays, structs containing them) can't be copied as bytes
+        // Object references are rejected even though raw pointers are plain data, a buffer can't keep objects alive or be checked for valid objects when it's copied back
+        if (!lua_object.m_inner_property->HasAnyPropertyFlags(Unreal::EPropertyFlags::CPF_IsPlainOldData) ||
+            lua_object.m_inner_property->IsA<Unreal::FObjectPropertyBase>())
+        {
+            lua.throw_error(fmt::format("[TArray:{}] Property type '{}' isn't plain data and can't be copied as raw memory, use 'ToTable' or 'ForEach' instead.",
+                                        function_name,
+                                        to_string(lua_object.m_inner_property->GetClass().GetFName().ToString())));
+        }
+    }
+
     auto TArray::prepare_to_handle(const LuaMadeSimple::Type::Operation operation, const LuaMadeSimple::Lua& lua) -> void
     {
         auto& lua_object = lua.get_userdata<TArray>();
@@ -142,11 +142,11 @@ namespace RC::LuaType
                                                           .property = nullptr};
 
                                pusher_params.property = info.key;
-                               StaticState::m_property_value_pushers[static_cast<int32_t>(info.key_fname.GetComparisonIndex())](pusher_params);
+                               info.key_pusher(pusher_params);
 
                                pusher_params.data = static_cast<uint8_t*>(pusher_params.data) + info.layout.ValueOffset;
                                pusher_params.property = info.value;
-                               StaticState::m_property_value_pushers[static_cast<int32_t>(info.value_fname.GetComparisonIndex())](pusher_params);
+                               info.value_pusher(pusher_params);
 
                                // Call function passing key & value, expecting 1 return value
                                // Mutating the key is undefined behavior
@@ -205,7 +205,7 @@ namespace RC::LuaType
                                                  .base = lua_object.m_base,
                                                  .data = key_data.GetData(),
                                                  .property = info.key};
-                StaticState::m_property_value_pushers[static_cast<int32_t>(info.key_fname.GetComparisonIndex())](pusher_params);
+                info.key_pusher(pusher_params);
             }
 
             Unreal::uint8* value_ptr = map->FindValue(key_data.GetData(),
@@ -226,7 +226,7 @@ namespace RC::LuaType
                                              .base = lua_object.m_base,
                                              .data = value_ptr,
                                              .property = info.value};
-            StaticState::m_property_value_pushers[static_cast<int32_t>(info.value_fname.GetComparisonIndex())](pusher_params);
+            info.value_pusher(pusher_params);
             break;
         }
         case MapOperation::Add: {
@@ -239,11 +239,11 @@ namespace RC::LuaType
                                        .data = pair_data.GetData(),
                                        .property = info.key};
 
-            StaticState::m_property_value_pushers[static_cast<int32_t>(info.key_fname.GetComparisonIndex())](pusher_params);
+            info.key_pusher(pusher_params);
 
             pusher_params.property = info.value;
             pusher_params.data = static_cast<uint8_t*>(pusher_params.data) + info.layout.ValueOffset;
-            StaticState::m_property_value_pushers[static_cast<int32_t>(info.value_fname.GetComparisonIndex())](pusher_params);
+            info.value_pusher(pusher_params);
 
             void* key_ptr = pair_data.GetData();
             void* value_ptr = pair_data.GetData() + info.layout.ValueOffset;
@@ -305,7 +305,7 @@ namespace RC::LuaType
                                        .base = lua_object.m_base,
                                        .data = key_data.GetData(),
                                        .property = info.key};
-            StaticState::m_property_value_pushers[static_cast<int32_t>(info.key_fname.GetComparisonIndex())](pusher_params);
+            info.key_pusher(pusher_params);
 
             Unreal::int32 index = map->FindPairIndex(key_data.GetData(),
                                                      info.layout,
@@ -329,7 +329,7 @@ namespace RC::LuaType
                                        .base = lua_object.m_base,
                                        .data = key_data.GetData(),
                                        .property = info.key};
-            StaticState::m_property_value_pushers[static_cast<int32_t>(info.key_fname.GetComparisonIndex())](pusher_params);
+            info.key_pusher(pusher_params);
 
             Unreal::int32 index = map->FindPairIndex(key_data.GetData(),
                                                      info.layout,
@@ -367,17 +367,17 @@ namespace RC::LuaType
 
     void FScriptMapInfo::validate_pushers(const LuaMadeSimple::Lua& lua)
     {
-        int32_t key_comparison_index = static_cast<int32_t>(key_fname.GetComparisonIndex());
-        if (!StaticState::m_property_value_pushers.contains(key_comparison_index))
+        key_pusher = StaticState::m_property_value_pushers.find(static_cast<int32_t>(key_fname.GetComparisonIndex()));
+        if (!key_pusher)
         {
             std::string inner_type_name = to_string(key_fname.ToString());
             lua.throw_error(fmt::format("Tried interacting with a map with an unsupported key type {}", inner_type_name));
         }
 
-        int32_t value_comparison_index = static_cast<int32_t>(value_fname.GetComparisonIndex());
-        if (!StaticState::m_property_value_pushers.contains(value_comparison_index))
+        value_pusher = StaticState::m_property_value_pushers.find(static_cast<int32_t>(value_fname.GetComparisonIndex()));
+        if (!value_pusher)
         {
-            std::string inner_type_name = to_string(key_fname.ToString());
+            std::string inner_type_name = to_string(value_fname.ToString());
             lua.throw_error(fmt::format("Tried interacting with a map with an unsupported value type {}", inner_type_name));
         }
     }
@@ -136,7 +136,7 @@ namespace RC::LuaType
                                         .base = lua_object.m_base,
                                         .data = element_data.GetData(),
                                         .property = info.element};
-            StaticState::m_property_value_pushers[static_cast<int32_t>(info.element_fname.GetComparisonIndex())](pusher_params);
+            info.element_pusher(pusher_params);
 
             void* element_ptr = element_data.GetData();
 
@@ -187,7 +187,7 @@ namespace RC::LuaType
                                        .base = lua_object.m_base,
                                        .data = element_data.GetData(),
                                        .property = info.element};
-            StaticState::m_property_value_pushers[static_cast<int32_t>(info.element_fname.GetComparisonIndex())](pusher_params);
+            info.element_pusher(pusher_params);
 
             // Create a SetHelper with the set data
             Unreal::FScriptSetHelper SetHelper(lua_object.m_property, set);
@@ -208,7 +208,7 @@ namespace RC::LuaType
                                        .base = lua_object.m_base,
                                        .data = element_data.GetData(),
                                        .property = info.element};
-            StaticState::m_property_value_pushers[static_cast<int32_t>(info.element_fname.GetComparisonIndex())](pusher_params);
+            info.element_pusher(pusher_params);
 
             // Create a SetHelper with the set data
             Unreal::FScriptSetHelper SetHelper(lua_object.m_property, set);
@@ -248,7 +248,7 @@ namespace RC::LuaType
                                            .data = element_data,
                                            .property = info.element};
 
-                StaticState::m_property_value_pushers[static_cast<int32_t>(info.element_fname.GetComparisonIndex())](pusher_params);
+                info.element_pusher(pusher_params);
 
                 // Call function passing element, expecting 1 return value
                 lua.call_function(1, 1);
@@ -282,8 +282,8 @@ namespace RC::LuaType
 
     void FScriptSetInfo::validate_pushers(const LuaMadeSimple::Lua& lua)
     {
-        int32_t element_comparison_index = static_cast<int32_t>(element_fname.GetComparisonIndex());
-        if (!StaticState::m_property_value_pushers.contains(element_comparison_index))
+        element_pusher = StaticState::m_property_value_pushers.find(static_cast<int32_t>(element_fname.GetComparisonIndex()));
+        if (!element_pusher)
         {
             std::string element_type_name = to_string(element_fname.ToString());
             lua.throw_error(fmt::format("Tried interacting with a set with an unsupported element type {}", element_type_name));
@@ -311,7 +311,7 @@ namespace RC::LuaType
 
                 // Get row data from Lua table at position 1
                 Unreal::int32 comparison_index = static_cast<Unreal::int32>(info.row_struct_fname.GetComparisonIndex());
-                if (StaticState::m_property_value_pushers.contains(comparison_index))
+                if (auto pusher = StaticState::m_property_value_pushers.find(comparison_index))
                 {
                     // Use specific pusher if available
                     PusherParams pusher_params{
@@ -323,7 +323,7 @@ namespace RC::LuaType
                     };
 
                     lua_pushvalue(lua.get_lua_state(), 1); // Table is at position 1 now
-                    StaticState::m_property_value_pushers[comparison_index](pusher_params);
+                    pusher(pusher_params);
                     lua.discard_value(-1);
                 }
                 else
@@ -1,3 +1,6 @@
+#include <atomic>
+#include <unordered_map>
+
 #include <Helpers/Casting.hpp>
 #include <LuaType/LuaAActor.hpp>
 #include <LuaType/LuaCustomProperty.hpp>
@@ -70,10 +73,108 @@ namespace RC::LuaType
         return object && s_lua_unreal_objects.contains(object->HashObject());
     }
 
+    // Transparent so that the cache can be searched with a view of the Luau string without copying it
+    struct PropertyLookupNameHash
+    {
+        using is_transparent = void;
+        auto operator()(std::string_view name) const -> size_t
+        {
+            return std::hash<std::string_view>{}(name);
+        }
+    };
+    using PropertyLookupCacheForStruct = std::unordered_map<std::string, MemberLookupResult, PropertyLookupNameHash, std::equal_to<>>;
+    struct PropertyLookupCache
+    {
+        uint64_t generation{};
+        // Key: the UStruct that was searched (the object itself if it's a UStruct, otherwise its class)
+        std::unordered_map<const Unreal::UStruct*, PropertyLookupCacheForStruct> structs{};
+    };
+    // Every thread that runs Lua has its own cache so that lookups don't need a lock.
+    // A thread throws its cache away the next time it looks something up after the generation has changed.
+    static thread_local PropertyLookupCache t_property_lookup_cache{};
+    static std::atomic<uint64_t> s_property_lookup_cache_generation{};
+    // Every UStruct that's in at least one thread's cache, so that the delete listener only invalidates the caches when one of them is deleted.
+    static std::unordered_set<const Unreal::UStruct*> s_property_lookup_cached_structs{};
+    static std::mutex s_property_lookup_cached_structs_mutex{};
+    // Names that aren't members are cached as well, this keeps scripts that index objects with generated names from growing a cache forever.
+    static constexpr size_t s_max_property_lookup_cache_entries_per_struct = 512;
+
+    static auto remove_from_property_lookup_cache(const Unreal::UObject* object) -> void
+    {
+        std::lock_guard lock{s_property_lookup_cached_structs_mutex};
+        if (s_property_lookup_cached_structs.erase(static_cast<const Unreal::UStruct*>(object)) > 0)
+        {
+            s_property_lookup_cache_generation.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    auto clear_property_lookup_cache() -> void
+    {
+        std::lock_guard lock{s_property_lookup_cached_structs_mutex};
+        s_property_lookup_cached_structs.clear();
+        s_property_lookup_cache_generation.fetch_add(1, std::memory_order_release);
+    }
+
+    auto find_member_for_lua(Unreal::UObject* object, std::string_view member_name) -> MemberLookupResult
+    {
+        auto* owner = Unreal::Cast<Unreal::UStruct>(object);
+        if (!owner)
+        {
+            owner = object->GetClassPrivate();
+        }
+
+        auto& cache = t_property_lookup_cache;
+        if (const auto generation = s_property_lookup_cache_generation.load(std::memory_order_acquire); generation != cache.generation)
+        {
+            cache.structs.clear();
+            cache.generation = generation;
+        }
+
+        auto owner_it = cache.structs.find(owner);
+        if (owner_it != cache.structs.end())
+        {
+            if (auto it = owner_it->second.find(member_name); it != owner_it->second.end())
+            {
+                return it->second;
+            }
+        }
+        else
+        {
+            {
+                std::lock_guard lock{s_property_lookup_cached_structs_mutex};
+                s_property_lookup_cached_structs.emplace(owner);
+            }
+            owner_it = cache.structs.emplace(owner, PropertyLookupCacheForStruct{}).first;
+        }
+
+        const StringType& member_name_str = ensure_str_const(member_name);
+
+        MemberLookupResult result{};
+        result.property_name = Unreal::FName(member_name_str, Unreal::FNAME_Find);
+        result.field = LuaCustomProperty::StaticStorage::property_list.find_or_nullptr(object, member_name_str);
+        if (!result.field)
+        {
+            result.field = owner->FindProperty(result.property_name);
+        }
+        if (result.field && result.field->GetClass().GetFName() != Unreal::GFunctionName)
+        {
+            result.pusher = StaticState::m_property_value_pushers.find(result.field->GetClass().GetFName().GetComparisonIndex());
+        }
+
+        auto& struct_cache = owner_it->second;
+        if (struct_cache.size() >= s_max_property_lookup_cache_entries_per_struct)
+        {
+            struct_cache.clear();
+        }
+        struct_cache.emplace(member_name, result);
+        return result;
+    }
+
     FLuaObjectDeleteListener FLuaObjectDeleteListener::s_lua_object_delete_listener{};
     void FLuaObjectDeleteListener::NotifyUObjectDeleted(const Unreal::UObjectBase* object, [[maybe_unused]] int32_t index)
     {
         remove_from_global_unreal_objects_map(static_cast<const Unreal::UObject*>(object));
+        remove_from_property_lookup_cache(static_cast<const Unreal::UObject*>(object));
     }
 
     auto call_ufunction_from_lua(const LuaMadeSimple::Lua& lua) -> int
@@ -214,7 +315,7 @@ namespace RC::LuaType
 
                     int32_t name_comparison_index = property_type_fname.GetComparisonIndex();
 
-                    if (StaticState::m_property_value_pushers.contains(name_comparison_index))
+                    if (auto pusher = StaticState::m_property_value_pushers.find(name_comparison_index))
                     {
                         void* data = &dynamic_unreal_function_data.data[offset_internal];
 
@@ -223,7 +324,7 @@ namespace RC::LuaType
                                                          .base = static_cast<Unreal::UObject*>(static_cast<void*>(dynamic_unreal_function_data.data)),
                                                          .data = data,
                                                          .property = param_next};
-                        StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
+                        pusher(pusher_params);
                     }
                     else
                     {
@@ -266,7 +367,7 @@ namespace RC::LuaType
                 Unreal::FName param_type_fname = param->GetClass().GetFName();
                 int32_t name_comparison_index = param_type_fname.GetComparisonIndex();
 
-                if (StaticState::m_property_value_pushers.contains(name_comparison_index))
+                if (auto pusher = StaticState::m_property_value_pushers.find(name_comparison_index))
                 {
                     uint8_t* data = &dynamic_unreal_function_data.data[param->GetOffset_Internal()];
 
@@ -278,7 +379,7 @@ namespace RC::LuaType
                             .property = param,
                             .create_new_if_get_non_trivial_local = !reuse_same_table,
                     };
-                    StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
+                    pusher(pusher_params);
                 }
                 else
                 {
@@ -298,7 +399,7 @@ namespace RC::LuaType
         {
             int32_t name_comparison_index = return_value_property_type.GetComparisonIndex();
 
-            if (StaticState::m_property_value_pushers.contains(name_comparison_index))
+            if (auto pusher = StaticState::m_property_value_pushers.find(name_comparison_index))
             {
                 uint8_t* data = &dynamic_unreal_function_data.data[return_value_property_offset_internal];
 
@@ -307,7 +408,7 @@ namespace RC::LuaType
                                                  .base = static_cast<Unreal::UObject*>(static_cast<void*>(data)), // Base is the start of the params struct
                                                  .data = data,
                                                  .property = return_value_property};
-                StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
+                pusher(pusher_params);
 
                 return 1;
             }
@@ -568,7 +669,7 @@ namespace RC::LuaType
 
             int32_t name_comparison_index = field_type_fname.GetComparisonIndex();
 
-            if (StaticState::m_property_value_pushers.contains(name_comparison_index))
+            if (auto pusher = StaticState::m_property_value_pushers.find(name_comparison_index))
             {
                 void* field_data = &static_cast<uint8_t*>(data)[field->GetOffset_Internal()];
 
@@ -581,7 +682,7 @@ namespace RC::LuaType
                         .stored_at_index = -1 // Value is at top of stack
                 };
 
-                StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
+                pusher(pusher_params);
             }
             else
             {
@@ -636,7 +737,8 @@ namespace RC::LuaType
             int32_t name_comparison_index = field_type_fname.GetComparisonIndex();
 
             // Check if we can handle this field type
-            bool can_handle = StaticState::m_property_value_pushers.contains(name_comparison_index);
+            auto pusher = StaticState::m_property_value_pushers.find(name_comparison_index);
+            bool can_handle = pusher != nullptr;
 
             if (can_handle)
             {
@@ -677,7 +779,7 @@ namespace RC::LuaType
                         .property = field
                 };
 
-                StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
+                pusher(pusher_params);
                 lua_table.fuse_pair();
             }
             else
@@ -785,7 +887,7 @@ namespace RC::LuaType
             Unreal::FName property_type_fname = array_inner->GetClass().GetFName();
             int32_t name_comparison_index = property_type_fname.GetComparisonIndex();
 
-            if (StaticState::m_property_value_pushers.contains(name_comparison_index))
+            if (auto pusher = StaticState::m_property_value_pushers.find(name_comparison_index))
             {
                 Unreal::FScriptArray* array_container = static_cast<Unreal::FScriptArray*>(data_ptr);
 
@@ -814,7 +916,7 @@ namespace RC::LuaType
                                                      .base = params.base,
                                                      .data = array_data + (i * array_inner->GetElementSize()),
                                                      .property = array_inner};
-                    StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
+                    pusher(pusher_params);
 
                     lua_table.fuse_pair();
                 }
@@ -837,7 +939,8 @@ namespace RC::LuaType
             Unreal::FName inner_type_fname = inner->GetClass().GetFName();
 
             int32_t name_comparison_index = inner_type_fname.GetComparisonIndex();
-            if (!StaticState::m_property_value_pushers.contains(name_comparison_index))
+            auto pusher = StaticState::m_property_value_pushers.find(name_comparison_index);
+            if (!pusher)
             {
                 std::string inner_type_name = to_utf8_string(inner_type_fname.ToString());
                 params.throw_error("push_arrayproperty", "Tried pushing ArrayProperty with unsupported inner type", "Inner property type", inner_type_name);
@@ -868,7 +971,7 @@ namespace RC::LuaType
                                                      .base = static_cast<Unreal::UObject*>(array->GetData()), // Base is the start of the params struct
                                                      .data = &static_cast<uint8_t*>(array->GetData())[array_element_size * element_index],
                                                      .property = inner};
-                    StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
+                    pusher(pusher_params);
 
                     ++element_index;
 
@@ -1016,7 +1119,7 @@ namespace RC::LuaType
                                           .data = element_data,
                                           .property = info.element};
                                           
-                StaticState::m_property_value_pushers[static_cast<int32_t>(info.element_fname.GetComparisonIndex())](pusher_params);
+                info.element_pusher(pusher_params);
                 
                 // Combine key and value in the table
                 lua_table.fuse_pair();
@@ -1075,7 +1178,7 @@ namespace RC::LuaType
                                           .data = element_data.GetData(),
                                           .property = info.element};
                                           
-                StaticState::m_property_value_pushers[static_cast<int32_t>(info.element_fname.GetComparisonIndex())](pusher_params);
+                info.element_pusher(pusher_params);
                 
                 // Add element to the set
                 void* element_ptr = element_data.GetData();
@@ -1246,11 +1349,11 @@ namespace RC::LuaType
                                            .property = nullptr};
 
                 pusher_params.property = info.key;
-                StaticState::m_property_value_pushers[static_cast<int32_t>(info.key_fname.GetComparisonIndex())](pusher_params);
+                info.key_pusher(pusher_params);
 
                 pusher_params.data = static_cast<uint8_t*>(pusher_params.data) + info.layout.ValueOffset;
                 pusher_params.property = info.value;
-                StaticState::m_property_value_pushers[static_cast<int32_t>(info.value_fname.GetComparisonIndex())](pusher_params);
+                info.value_pusher(pusher_params);
 
                 lua_table.fuse_pair();
             }
@@ -1284,11 +1387,11 @@ namespace RC::LuaType
                 Unreal::FMemory::Memzero(pusher_params.data, info.layout.SetLayout.Size);
 
                 pusher_params.property = info.key;
-                StaticState::m_property_value_pushers[static_cast<int32_t>(info.key_fname.GetComparisonIndex())](pusher_params);
+                info.key_pusher(pusher_params);
 
                 pusher_params.data = static_cast<uint8_t*>(pusher_params.data) + info.layout.ValueOffset;
                 pusher_params.property = info.value;
-                StaticState::m_property_value_pushers[static_cast<int32_t>(info.value_fname.GetComparisonIndex())](pusher_params);
+                info.value_pusher(pusher_params);
 
                 return false;
             });
@@ -2129,8 +2232,12 @@ Overloads:
         return 1;
     }
 
-    auto handle_unreal_property_value(
-            const Operation operation, const LuaMadeSimple::Lua& lua, Unreal::UObject* base, Unreal::FName property_name, Unreal::FField* field) -> void
+    auto handle_unreal_property_value(const Operation operation,
+                                      const LuaMadeSimple::Lua& lua,
+                                      Unreal::UObject* base,
+                                      Unreal::FName property_name,
+                                      Unreal::FField* field,
+                                      StaticState::PropertyValuePusherCallable pusher) -> void
     {
         // In UE versions prior to 4.25, UFunctions can be found with 'find_property', and thus 'property' will not be nullptr
         // So you must take that into account when checking if the Lua script is trying to call a UFunction
@@ -2168,21 +2275,23 @@ Overloads:
         // This is because UFunction & XProperty both inherit from XField, but UFunction doesn't inherit from XProperty
         Unreal::FProperty* property = static_cast<Unreal::FProperty*>(field);
 
-        Unreal::FName property_type = property->GetClass().GetFName();
-        int32_t name_comparison_index = property_type.GetComparisonIndex();
+        if (!pusher)
+        {
+            pusher = StaticState::m_property_value_pushers.find(property->GetClass().GetFName().GetComparisonIndex());
+        }
 
-        if (StaticState::m_property_value_pushers.contains(name_comparison_index))
+        if (pusher)
         {
             void* data = static_cast<uint8_t*>(static_cast<void*>(base)) + property->GetOffset_Internal();
 
             const PusherParams pusher_params{.operation = operation, .lua = lua, .base = base, .data = data, .property = property};
-            StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
+            pusher(pusher_params);
         }
         else
         {
             // We can either throw an error and kill the execution
             /**/
-            std::string property_type_name = to_string(property_type.ToString());
+            std::string property_type_name = to_string(property->GetClass().GetFName().ToString());
             lua.throw_error(fmt::format(
                     "[handle_unreal_property_value] Tried accessing unreal property without a registered handler. Property type '{}' not supported.",
                     property_type_name));
@@ -2298,14 +2407,14 @@ Overloads:
 
         int32_t type_name_comparison_index = lua_object.m_type.GetComparisonIndex();
 
-        if (StaticState::m_property_value_pushers.contains(type_name_comparison_index))
+        if (auto pusher = StaticState::m_property_value_pushers.find(type_name_comparison_index))
         {
             const PusherParams pusher_params{.operation = operation,
                                              .lua = lua,
                                              .base = lua_object.m_base,
                                              .data = lua_object.get_remote_cpp_object(),
                                              .property = lua_object.m_property};
-            StaticState::m_property_value_pushers[type_name_comparison_index](pusher_params);
+            pusher(pusher_params);
         }
         else
         {
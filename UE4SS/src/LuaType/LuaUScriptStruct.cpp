@@ -183,12 +183,12 @@ namespace RC::LuaType
         auto property_type_fname = property->GetClass().GetFName();
         int32_t name_comparison_index = property_type_fname.GetComparisonIndex();
 
-        if (StaticState::m_property_value_pushers.contains(name_comparison_index))
+        if (auto pusher = StaticState::m_property_value_pushers.find(name_comparison_index))
         {
             void* data = Helper::Casting::ptr_cast<void*>(struct_data.start_of_struct, property->GetOffset_Internal());
 
             const PusherParams pusher_params{.operation = operation, .lua = lua, .base = nullptr, .data = data, .property = property};
-            StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
+            pusher(pusher_params);
         }
         else
         {
@@ -259,7 +259,7 @@ namespace RC::LuaType
 
                                int32_t name_comparison_index = param->GetClass().GetFName().GetComparisonIndex();
 
-                               if (StaticState::m_property_value_pushers.contains(name_comparison_index))
+                               if (auto pusher = StaticState::m_property_value_pushers.find(name_comparison_index))
                                {
                                    const PusherParams pusher_params{
                                            .operation = Operation::Set,
@@ -268,7 +268,7 @@ namespace RC::LuaType
                                            .data = param_data,
                                            .property = param
                                    };
-                                   StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
+                                   pusher(pusher_params);
                                }
 
                                lua_param_index++;
@@ -538,7 +538,7 @@ namespace RC::LuaType
 
                                int32_t name_comparison_index = param->GetClass().GetFName().GetComparisonIndex();
 
-                               if (StaticState::m_property_value_pushers.contains(name_comparison_index))
+                               if (auto pusher = StaticState::m_property_value_pushers.find(name_comparison_index))
                                {
                                    const PusherParams pusher_params{
                                            .operation = Operation::Set,
@@ -547,7 +547,7 @@ namespace RC::LuaType
                                            .data = param_data,
                                            .property = param
                                    };
-                                   StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
+                                   pusher(pusher_params);
                                }
 
                                lua_param_index++;
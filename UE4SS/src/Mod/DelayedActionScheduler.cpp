@@ -0,0 +1,240 @@
+#include <algorithm>
+
+#include <Mod/DelayedActionScheduler.hpp>
+
+namespace RC
+{
+    // std::push_heap & std::pop_heap build max-heaps, so these compare backwards to keep the earliest entry at the front
+    // Ties are broken by 'schedule_id' so that actions due at the same time are executed in the order they were scheduled
+    static auto timer_entry_greater(const auto& a, const auto& b) -> bool
+    {
+        if (a.execute_at != b.execute_at)
+        {
+            return a.execute_at > b.execute_at;
+        }
+        return a.schedule_id > b.schedule_id;
+    }
+
+    static auto frame_entry_greater(const auto& a, const auto& b) -> bool
+    {
+        if (a.execute_at_frame != b.execute_at_frame)
+        {
+            return a.execute_at_frame > b.execute_at_frame;
+        }
+        return a.schedule_id > b.schedule_id;
+    }
+
+    static auto is_frame_based(const DelayedGameThreadAction& action) -> bool
+    {
+        return action.method == GameThreadExecutionMethod::EngineTick && action.delay_frames > 0;
+    }
+
+    auto DelayedActionScheduler::add(DelayedGameThreadAction action) -> DelayedGameThreadAction&
+    {
+        auto [it, inserted] = m_actions.try_emplace(action.handle, action);
+        if (!inserted)
+        {
+            cancel(it->second);
+            it = m_actions.emplace(action.handle, action).first;
+        }
+        restart(it->second);
+        return it->second;
+    }
+
+    auto DelayedActionScheduler::find(int64_t handle) -> DelayedGameThreadAction*
+    {
+        auto it = m_actions.find(handle);
+        return it == m_actions.end() ? nullptr : &it->second;
+    }
+
+    auto DelayedActionScheduler::get_frames_remaining(const DelayedGameThreadAction& action) const -> int64_t
+    {
+        if (action.status == DelayedActionStatus::Paused)
+        {
+            return action.frames_remaining;
+        }
+        return action.execute_at_frame > m_current_frame ? static_cast<int64_t>(action.execute_at_frame - m_current_frame) : 0;
+    }
+
+    auto DelayedActionScheduler::restart(DelayedGameThreadAction& action) -> void
+    {
+        action.status = DelayedActionStatus::Active;
+        if (is_frame_based(action))
+        {
+            action.execute_at_frame = m_current_frame + static_cast<uint64_t>(action.delay_frames);
+        }
+        else
+        {
+            action.execute_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(action.delay_ms);
+        }
+        schedule(action);
+    }
+
+    auto DelayedActionScheduler::pause(DelayedGameThreadAction& action) -> void
+    {
+        if (is_frame_based(action))
+        {
+            action.frames_remaining = get_frames_remaining(action);
+        }
+        else
+        {
+            const auto now = std::chrono::steady_clock::now();
+            action.time_remaining_ms = action.execute_at > now ? std::chrono::duration_cast<std::chrono::milliseconds>(action.execute_at - now).count() : 0;
+        }
+        // The queue entry is skipped when it's reached, 'unpause' adds a new one
+        action.status = DelayedActionStatus::Paused;
+    }
+
+    auto DelayedActionScheduler::unpause(DelayedGameThreadAction& action) -> void
+    {
+        if (is_frame_based(action))
+        {
+            action.execute_at_frame = m_current_frame + static_cast<uint64_t>(action.frames_remaining);
+        }
+        else
+        {
+            action.execute_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(action.time_remaining_ms);
+        }
+        action.status = DelayedActionStatus::Active;
+        schedule(action);
+    }
+
+    auto DelayedActionScheduler::cancel(DelayedGameThreadAction& action) -> void
+    {
+        // Cancelling can happen from any Lua thread, so the function ref is released later on the game thread
+        // The thread ref isn't released, the thread is shared across all actions and is anchored in the registry by ensure_hook_thread_exists
+        m_pending_unrefs.emplace_back(PendingUnref{action.lua, action.lua_action_function_ref});
+        m_actions.erase(action.handle);
+    }
+
+    auto DelayedActionScheduler::cancel_all_for(const LuaMadeSimple::Lua* lua) -> int64_t
+    {
+        int64_t count{};
+        for (auto it = m_actions.begin(); it != m_actions.end();)
+        {
+            if (it->second.lua == lua)
+            {
+                m_pending_unrefs.emplace_back(PendingUnref{it->second.lua, it->second.lua_action_function_ref});
+                it = m_actions.erase(it);
+                ++count;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        return count;
+    }
+
+    auto DelayedActionScheduler::remove_all_for(const LuaMadeSimple::Lua* lua) -> void
+    {
+        std::erase_if(m_actions, [&](const auto& pair) {
+            return pair.second.lua == lua;
+        });
+        std::erase_if(m_pending_unrefs, [&](const PendingUnref& pending_unref) {
+            return pending_unref.lua == lua;
+        });
+    }
+
+    auto DelayedActionScheduler::schedule(DelayedGameThreadAction& action) -> void
+    {
+        action.schedule_id = m_next_schedule_id++;
+        if (is_frame_based(action))
+        {
+            m_frame_queue.emplace_back(FrameEntry{action.execute_at_frame, action.schedule_id, action.handle});
+            std::push_heap(m_frame_queue.begin(), m_frame_queue.end(), frame_entry_greater<FrameEntry, FrameEntry>);
+        }
+        else
+        {
+            auto& queue = m_timer_queues[static_cast<size_t>(action.method)];
+            queue.emplace_back(TimerEntry{action.execute_at, action.schedule_id, action.handle});
+            std::push_heap(queue.begin(), queue.end(), timer_entry_greater<TimerEntry, TimerEntry>);
+        }
+
+        // Restarting an action leaves its old entry in the queue, which can pile up if a mod keeps retriggering a long delay
+        if (m_timer_queues[0].size() + m_timer_queues[1].size() + m_frame_queue.size() > m_actions.size() * 2 + 64)
+        {
+            compact_queues();
+        }
+    }
+
+    auto DelayedActionScheduler::pop_due_action(GameThreadExecutionMethod method, std::chrono::steady_clock::time_point now) -> DelayedGameThreadAction*
+    {
+        const auto get_if_current = [&](int64_t handle, uint64_t schedule_id) -> DelayedGameThreadAction* {
+            auto action = find(handle);
+            return action && action->schedule_id == schedule_id && action->status == DelayedActionStatus::Active ? action : nullptr;
+        };
+
+        if (method == GameThreadExecutionMethod::EngineTick)
+        {
+            while (!m_frame_queue.empty() && m_frame_queue.front().execute_at_frame <= m_current_frame)
+            {
+                std::pop_heap(m_frame_queue.begin(), m_frame_queue.end(), frame_entry_greater<FrameEntry, FrameEntry>);
+                const auto entry = m_frame_queue.back();
+                m_frame_queue.pop_back();
+                if (auto action = get_if_current(entry.handle, entry.schedule_id))
+                {
+                    return action;
+                }
+            }
+        }
+
+        auto& queue = m_timer_queues[static_cast<size_t>(method)];
+        while (!queue.empty() && queue.front().execute_at <= now)
+        {
+            std::pop_heap(queue.begin(), queue.end(), timer_entry_greater<TimerEntry, TimerEntry>);
+            const auto entry = queue.back();
+            queue.pop_back();
+            if (auto action = get_if_current(entry.handle, entry.schedule_id))
+            {
+                return action;
+            }
+        }
+
+        return nullptr;
+    }
+
+    auto DelayedActionScheduler::finish(DelayedGameThreadAction& action) -> void
+    {
+        // Unref the function, but NOT the thread - the thread is shared across all actions
+        // and is anchored in the registry by ensure_hook_thread_exists
+        luaL_unref(action.lua->get_lua_state(), LUA_REGISTRYINDEX, action.lua_action_function_ref);
+        m_actions.erase(action.handle);
+    }
+
+    auto DelayedActionScheduler::release_pending_unrefs() -> void
+    {
+        for (const auto& pending_unref : m_pending_unrefs)
+        {
+            luaL_unref(pending_unref.lua->get_lua_state(), LUA_REGISTRYINDEX, pending_unref.lua_action_function_ref);
+        }
+        m_pending_unrefs.clear();
+    }
+
+    auto DelayedActionScheduler::compact_queues() -> void
+    {
+        m_timer_queues[0].clear();
+        m_timer_queues[1].clear();
+        m_frame_queue.clear();
+        for (auto& [handle, action] : m_actions)
+        {
+            if (action.status != DelayedActionStatus::Active)
+            {
+                continue;
+            }
+            if (is_frame_based(action))
+            {
+                m_frame_queue.emplace_back(FrameEntry{action.execute_at_frame, action.schedule_id, handle});
+            }
+            else
+            {
+                m_timer_queues[static_cast<size_t>(action.method)].emplace_back(TimerEntry{action.execute_at, action.schedule_id, handle});
+            }
+        }
+        std::make_heap(m_frame_queue.begin(), m_frame_queue.end(), frame_entry_greater<FrameEntry, FrameEntry>);
+        for (auto& queue : m_timer_queues)
+        {
+            std::make_heap(queue.begin(), queue.end(), timer_entry_greater<TimerEntry, TimerEntry>);
+        }
+    }
+} // namespace RC
@@ -1,12 +1,17 @@
 #define NOMINMAX
 
+#include <algorithm>
 #include <atomic>
+#include <bit>
+#include <cctype>
 #include <filesystem>
 #include <format>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <unordered_set>
 
 #include <DynamicOutput/DynamicOutput.hpp>
 #include <ExceptionHandling.hpp>
@@ -29,18 +34,22 @@
 #include <Mod/CppMod.hpp>
 #include <Mod/LuaMod.hpp>
 #include <Mod/LuauIOLibrary.hpp>
+#include <Timer/ScopedTimer.hpp>
 #pragma warning(disable : 4005)
 #include <GUI/Dumpers.hpp>
 #include <UE4SSProgram.hpp>
 #include <USMapGenerator/Generator.hpp>
+#include <Unreal/AActor.hpp>
 #include <Unreal/Core/HAL/Platform.hpp>
 #include <Unreal/FFrame.hpp>
 #include <Unreal/FURL.hpp>
+#include <Unreal/FWeakObjectPtr.hpp>
 #include <Unreal/FWorldContext.hpp>
 #include <Unreal/FOutputDevice.hpp>
 #include <Unreal/CoreUObject/UObject/UnrealType.hpp>
 #include <Unreal/Hooks.hpp>
 #include <Unreal/PackageName.hpp>
+#include <Unreal/Searcher/ObjectSearcher.hpp>
 #include <Unreal/Property/FEnumProperty.hpp>
 #include <Unreal/CoreUObject/UObject/FStrProperty.hpp>
 #include <Unreal/Core/Containers/FUtf8String.hpp>
@@ -95,8 +104,47 @@ namespace RC
         }
     }
 
+    // Bumped whenever a hooked UFunction may have been relinked, e.g. when a map load reloads the package it lives in.
+    // A hook only compares this against the generation its plan was last checked at, the layout is only looked at again after a bump.
+    static std::atomic<uint32_t> s_marshalling_plan_generation{};
+
     struct LuaUnrealScriptFunctionData
     {
+        // One entry per non-return parameter of the hooked UFunction, in declaration order.
+        struct ParamMarshallingStep
+        {
+            Unreal::FProperty* property{};
+            // nullptr if there's no registered handler for this property type
+            LuaType::StaticState::PropertyValuePusherCallable pusher{};
+            int32_t offset{};
+            bool is_out_param{};
+        };
+
+        // Cheap snapshot of the UFunction layout that the marshalling plan was built from.
+        // If any of these changed when the generation is bumped (e.g. the UFunction was relinked), the plan is rebuilt.
+        struct MarshallingPlanKey
+        {
+            Unreal::FProperty* first_property{};
+            int32_t properties_size{};
+            uint16_t return_value_offset{0xFFFF};
+            uint8_t num_parms{};
+
+            auto operator==(const MarshallingPlanKey&) const -> bool = default;
+        };
+
+        // Never changed once it's been published, a rebuild publishes a new plan instead.
+        // Replaced plans are kept until the hook is unregistered, so a hook that's still using one on another thread can't lose it.
+        struct MarshallingPlan
+        {
+            MarshallingPlanKey key{};
+            bool has_return_value{};
+            // Will be non-nullptr if the UFunction has a return value
+            Unreal::FProperty* return_property{};
+            LuaType::StaticState::PropertyValuePusherCallable return_pusher{};
+            uint8_t num_unreal_params{};
+            std::vector<ParamMarshallingStep> params{};
+        };
+
         Unreal::CallbackId pre_callback_id;
         Unreal::CallbackId post_callback_id;
         Unreal::UFunction* unreal_function;
@@ -106,9 +154,11 @@ namespace RC
         const int lua_post_callback_ref;
         const int lua_thread_ref;
 
-        bool has_return_value{};
-        // Will be non-nullptr if the UFunction has a return value
-        Unreal::FProperty* return_property{};
+        std::atomic<const MarshallingPlan*> marshalling_plan{};
+        std::atomic<uint32_t> marshalling_plan_generation{};
+        // Owns the current plan & every plan it replaced
+        std::vector<std::unique_ptr<const MarshallingPlan>> marshalling_plans{};
+        std::mutex marshalling_plans_mutex{};
         std::atomic<bool> scheduled_for_removal{false};
 
         LuaUnrealScriptFunctionData(Unreal::CallbackId pre_id,
@@ -122,48 +172,44 @@ namespace RC
             : pre_callback_id(pre_id), post_callback_id(post_id), unreal_function(func), mod(m), lua(l),
               lua_callback_ref(cb_ref), lua_post_callback_ref(post_cb_ref), lua_thread_ref(thread_ref)
         {
+            marshalling_plan_generation.store(s_marshalling_plan_generation.load(std::memory_order_acquire), std::memory_order_relaxed);
+            marshalling_plan.store(marshalling_plans.emplace_back(build_marshalling_plan()).get(), std::memory_order_release);
         }
-    };
-    static std::vector<std::unique_ptr<LuaUnrealScriptFunctionData>> g_hooked_script_function_data{};
-
-    static auto lua_unreal_script_function_hook_pre(Unreal::UnrealScriptFunctionCallableContext context, void* custom_data) -> void
-    {
-        // Fetch the data corresponding to this UFunction
-        auto& lua_data = *static_cast<LuaUnrealScriptFunctionData*>(custom_data);
-
-        // Check if this hook has been scheduled for removal (Lua state may be invalid)
-        if (lua_data.scheduled_for_removal) return;
-
-        // Use the stored registry index to put a Lua function on the Lua stack
-        // This is the function that was provided by the Lua call to "RegisterHook"
-        lua_data.lua.registry().get_function_ref(lua_data.lua_callback_ref);
-
-        // Set up the first param (context / this-ptr)
-        // TODO: Check what happens if a static UFunction is hooked since they don't have any context
-        static auto s_object_property_name = Unreal::FName(STR("ObjectProperty"), Unreal::FNAME_Find);
-        LuaType::RemoteUnrealParam::construct(lua_data.lua, &context.Context, s_object_property_name);
-
-        // Attempt at dynamically fetching the params
-        const auto FunctionBeingExecuted = lua_data.unreal_function;
-        uint16_t return_value_offset = FunctionBeingExecuted->GetReturnValueOffset();
 
-        // 'ReturnValueOffset' is 0xFFFF if the UFunction return type is void
-        lua_data.has_return_value = return_value_offset != 0xFFFF;
+        auto make_marshalling_plan_key() const -> MarshallingPlanKey
+        {
+            return MarshallingPlanKey{.first_property = unreal_function->GetFirstProperty(),
+                                      .properties_size = unreal_function->GetPropertiesSize(),
+                                      .return_value_offset = unreal_function->GetReturnValueOffset(),
+                                      .num_parms = unreal_function->GetNumParms()};
+        }
 
-        uint8_t num_unreal_params = FunctionBeingExecuted->GetNumParms();
-        if (lua_data.has_return_value)
+        static auto find_pusher(Unreal::FProperty* property) -> LuaType::StaticState::PropertyValuePusherCallable
         {
-            // Subtract one from the number of params if there's a return value
-            // This is because Unreal treats the return value as a param, and it's included in the 'NumParms' member variable
-            --num_unreal_params;
+            const int32_t name_comparison_index = property->GetClass().GetFName().GetComparisonIndex();
+            return LuaType::StaticState::m_property_value_pushers.find(name_comparison_index);
         }
 
-        bool has_properties_to_process = lua_data.has_return_value || num_unreal_params > 0;
-        if (has_properties_to_process && (context.TheStack.Locals() || context.TheStack.OutParms()))
+        // Walks the UFunction params once and stores everything needed to push them to Lua.
+        // This keeps the reflection walk & the property type lookups out of the per-call path.
+        auto build_marshalling_plan() const -> std::unique_ptr<const MarshallingPlan>
         {
-            // int32_t current_param_offset{};
+            auto plan = std::make_unique<MarshallingPlan>();
+            plan->key = make_marshalling_plan_key();
+
+            // 'ReturnValueOffset' is 0xFFFF if the UFunction return type is void
+            plan->has_return_value = plan->key.return_value_offset != 0xFFFF;
+
+            plan->num_unreal_params = plan->key.num_parms;
+            if (plan->has_return_value)
+            {
+                // Subtract one from the number of params if there's a return value
+                // This is because Unreal treats the return value as a param, and it's included in the 'NumParms' member variable
+                --plan->num_unreal_params;
+            }
 
-            for (Unreal::FProperty* func_prop : Unreal::TFieldRange<Unreal::FProperty>(FunctionBeingExecuted, Unreal::EFieldIterationFlags::IncludeDeprecated))
+            plan->params.reserve(plan->num_unreal_params);
+            for (Unreal::FProperty* func_prop : Unreal::TFieldRange<Unreal::FProperty>(unreal_function, Unreal::EFieldIterationFlags::IncludeDeprecated))
             {
                 // Skip this property if it's not a parameter
                 if (!func_prop->HasAnyPropertyFlags(Unreal::EPropertyFlags::CPF_Parm))
@@ -172,52 +218,101 @@ namespace RC
                 }
 
                 // Skip if this property corresponds to the return value
-                if (lua_data.has_return_value && func_prop->GetOffset_Internal() == return_value_offset)
+                if (plan->has_return_value && func_prop->GetOffset_Internal() == plan->key.return_value_offset)
                 {
-                    lua_data.return_property = func_prop;
+                    plan->return_property = func_prop;
+                    plan->return_pusher = find_pusher(func_prop);
                     continue;
                 }
 
-                Unreal::FName property_type = func_prop->GetClass().GetFName();
-                int32_t name_comparison_index = property_type.GetComparisonIndex();
+                plan->params.emplace_back(ParamMarshallingStep{.property = func_prop,
+                                                               .pusher = find_pusher(func_prop),
+                                                               .offset = func_prop->GetOffset_Internal(),
+                                                               .is_out_param = func_prop->HasAnyPropertyFlags(Unreal::EPropertyFlags::CPF_OutParm)});
+            }
 
-                if (LuaType::StaticState::m_property_value_pushers.contains(name_comparison_index))
-                {
-                    // Non-typed pointer to the current parameter value
-                    void* data{};
-                    if (func_prop->HasAnyPropertyFlags(Unreal::EPropertyFlags::CPF_OutParm))
-                    {
-                        data = Unreal::FindOutParamValueAddress(context.TheStack, func_prop);
-                    }
-                    else
-                    {
-                        data = func_prop->ContainerPtrToValuePtr<void>(context.TheStack.Locals());
-                    }
+            return plan;
+        }
 
-                    // Keeping track of where in the 'Locals' array the next property is
-                    // current_param_offset += func_prop->GetSize();
+        // Returns the plan for the current UFunction layout
+        // Only looks at the layout again after the generation was bumped, and only publishes a new plan if the layout actually changed
+        auto get_marshalling_plan() -> const MarshallingPlan&
+        {
+            if (marshalling_plan_generation.load(std::memory_order_acquire) != s_marshalling_plan_generation.load(std::memory_order_relaxed))
+            {
+                revalidate_marshalling_plan();
+            }
+            return *marshalling_plan.load(std::memory_order_acquire);
+        }
 
-                    // Set up a call to a handler for this type of Unreal property (the param)
-                    // The FName is being used as a key for an unordered_map which has the types & corresponding handlers filled right after the dll is injected
-                    const LuaType::PusherParams pusher_params{.operation = LuaType::Operation::GetParam,
-                                                              .lua = lua_data.lua,
-                                                              .base = nullptr,
-                                                              .data = data,
-                                                              .property = func_prop};
-                    LuaType::StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
-                }
-                else
-                {
-                    lua_data.lua.throw_error(fmt::format(
-                            "[unreal_script_function_hook] Tried accessing unreal property without a registered handler. Property type '{}' not supported.",
-                            to_string(property_type.ToString())));
-                }
+        auto revalidate_marshalling_plan() -> void
+        {
+            std::lock_guard lock{marshalling_plans_mutex};
+            const auto generation = s_marshalling_plan_generation.load(std::memory_order_acquire);
+            if (marshalling_plan.load(std::memory_order_relaxed)->key != make_marshalling_plan_key())
+            {
+                marshalling_plan.store(marshalling_plans.emplace_back(build_marshalling_plan()).get(), std::memory_order_release);
+            }
+            marshalling_plan_generation.store(generation, std::memory_order_release);
+        }
+    };
+    static std::vector<std::unique_ptr<LuaUnrealScriptFunctionData>> g_hooked_script_function_data{};
+
+    // Pushes every non-return param of the hooked UFunction to Lua by following the precompiled marshalling plan.
+    static auto push_hooked_function_params(LuaUnrealScriptFunctionData& lua_data,
+                                            const LuaUnrealScriptFunctionData::MarshallingPlan& plan,
+                                            Unreal::FFrame& stack) -> void
+    {
+        for (const auto& step : plan.params)
+        {
+            if (!step.pusher)
+            {
+                lua_data.lua.throw_error(fmt::format(
+                        "[unreal_script_function_hook] Tried accessing unreal property without a registered handler. Property type '{}' not supported.",
+                        to_string(step.property->GetClass().GetFName().ToString())));
             }
+
+            // Non-typed pointer to the current parameter value
+            // For out params (including ref params), the value lives in OutParms, for regular input params it's in Locals
+            void* data = step.is_out_param ? Unreal::FindOutParamValueAddress(stack, step.property) : static_cast<uint8_t*>(stack.Locals()) + step.offset;
+
+            const LuaType::PusherParams pusher_params{.operation = LuaType::Operation::GetParam,
+                                                      .lua = lua_data.lua,
+                                                      .base = nullptr,
+                                                      .data = data,
+                                                      .property = step.property};
+            step.pusher(pusher_params);
+        }
+    }
+
+    static auto lua_unreal_script_function_hook_pre(Unreal::UnrealScriptFunctionCallableContext context, void* custom_data) -> void
+    {
+        // Fetch the data corresponding to this UFunction
+        auto& lua_data = *static_cast<LuaUnrealScriptFunctionData*>(custom_data);
+
+        // Check if this hook has been scheduled for removal (Lua state may be invalid)
+        if (lua_data.scheduled_for_removal) return;
+
+        const auto& plan = lua_data.get_marshalling_plan();
+
+        // Use the stored registry index to put a Lua function on the Lua stack
+        // This is the function that was provided by the Lua call to "RegisterHook"
+        lua_data.lua.registry().get_function_ref(lua_data.lua_callback_ref);
+
+        // Set up the first param (context / this-ptr)
+        // TODO: Check what happens if a static UFunction is hooked since they don't have any context
+        static auto s_object_property_name = Unreal::FName(STR("ObjectProperty"), Unreal::FNAME_Find);
+        LuaType::RemoteUnrealParam::construct(lua_data.lua, &context.Context, s_object_property_name);
+
+        bool has_properties_to_process = plan.has_return_value || plan.num_unreal_params > 0;
+        if (has_properties_to_process && (context.TheStack.Locals() || context.TheStack.OutParms()))
+        {
+            push_hooked_function_params(lua_data, plan, context.TheStack);
         }
 
         // Call the Lua function with the correct number of parameters & return values
         // Increasing the 'num_params' by one to account for the 'this / context' param
-        lua_data.lua.call_function(num_unreal_params + 1, 1);
+        lua_data.lua.call_function(plan.num_unreal_params + 1, 1);
 
         // The params for the Lua script will be 'userdata' and they will have get/set functions
         // Use these functions in the Lua script to access & mutate the parameter values
@@ -270,6 +365,8 @@ namespace RC
             return;
         }
 
+        const auto& plan = lua_data.get_marshalling_plan();
+
         auto process_return_value = [&]() {
             // If 'nil' exists on the Lua stack, that means that the UFunction expected a return value but the Lua script didn't return anything
             // So we can simply clean the stack and let the UFunction decide the return value on its own
@@ -277,7 +374,7 @@ namespace RC
             {
                 lua_data.lua.discard_value();
             }
-            else if (lua_data.lua.get_stack_size() > 0 && lua_data.has_return_value && lua_data.return_property && context.RESULT_DECL)
+            else if (lua_data.lua.get_stack_size() > 0 && plan.has_return_value && plan.return_property && context.RESULT_DECL)
             {
                 // Fetch the return value from Lua if the UFunction expects one
                 // If no return value exists then assume that the Lua script didn't want to override the original
@@ -285,25 +382,22 @@ namespace RC
                 // That means that changing the return value here won't affect the script itself
                 // If this was a native UFunction then changing the return value here will have the desired effect
 
-                Unreal::FName property_type_name = lua_data.return_property->GetClass().GetFName();
-                int32_t name_comparison_index = property_type_name.GetComparisonIndex();
-
-                if (LuaType::StaticState::m_property_value_pushers.contains(name_comparison_index))
+                if (plan.return_pusher)
                 {
                     const LuaType::PusherParams pusher_params{.operation = LuaType::Operation::Set,
                                                               .lua = lua_data.lua,
                                                               .base = static_cast<Unreal::UObject*>(context.RESULT_DECL),
                                                               .data = context.RESULT_DECL,
-                                                              .property = lua_data.return_property};
-                    LuaType::StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
+                                                              .property = plan.return_property};
+                    plan.return_pusher(pusher_params);
                 }
                 else
                 {
                     // If the type wasn't supported then we simply clean the Lua stack, output a warning and then do nothing
                     lua_data.lua.discard_value();
 
-                    auto parameter_type_name = property_type_name.ToString();
-                    auto parameter_name = lua_data.return_property->GetName();
+                    auto parameter_type_name = plan.return_property->GetClass().GetFName().ToString();
+                    auto parameter_name = plan.return_property->GetName();
 
                     Output::send(
                             STR("Tried altering return value of a hooked UFunction without a registered handler for return type Return property '{}' of type "
@@ -324,96 +418,27 @@ namespace RC
             static auto s_object_property_name = Unreal::FName(STR("ObjectProperty"), Unreal::FNAME_Find);
             LuaType::RemoteUnrealParam::construct(lua_data.lua, &context.Context, s_object_property_name);
 
-            // Attempt at dynamically fetching the params
-            const auto FunctionBeingExecuted = lua_data.unreal_function;
-            uint16_t return_value_offset = FunctionBeingExecuted->GetReturnValueOffset();
-
-            // 'ReturnValueOffset' is 0xFFFF if the UFunction return type is void
-            lua_data.has_return_value = return_value_offset != 0xFFFF;
-
-            uint8_t num_unreal_params = FunctionBeingExecuted->GetNumParms();
-            if (lua_data.has_return_value)
+            // Set up the return value param so that Lua can access the original return value
+            if (plan.has_return_value && plan.return_pusher)
             {
-                // Subtract one from the number of params if there's a return value
-                // This is because Unreal treats the return value as a param, and it's included in the 'NumParms' member variable
-                --num_unreal_params;
-
-                // Set up the return value param so that Lua can access the original return value
-                auto return_property = FunctionBeingExecuted->GetReturnProperty();
-                auto return_property_type = return_property->GetClass().GetFName();
-                int32_t name_comparison_index = return_property_type.GetComparisonIndex();
-                if (LuaType::StaticState::m_property_value_pushers.contains(name_comparison_index))
-                {
-                    const LuaType::PusherParams pusher_params{.operation = LuaType::Operation::GetParam,
-                                                              .lua = lua_data.lua,
-                                                              .base = nullptr,
-                                                              .data = context.RESULT_DECL,
-                                                              .property = return_property};
-                    LuaType::StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
-                }
+                const LuaType::PusherParams pusher_params{.operation = LuaType::Operation::GetParam,
+                                                          .lua = lua_data.lua,
+                                                          .base = nullptr,
+                                                          .data = context.RESULT_DECL,
+                                                          .property = plan.return_property};
+                plan.return_pusher(pusher_params);
             }
 
-            bool has_properties_to_process = lua_data.has_return_value || num_unreal_params > 0;
+            bool has_properties_to_process = plan.has_return_value || plan.num_unreal_params > 0;
             if (has_properties_to_process && context.TheStack.Locals())
             {
-                for (Unreal::FProperty* func_prop : Unreal::TFieldRange<Unreal::FProperty>(FunctionBeingExecuted, Unreal::EFieldIterationFlags::IncludeDeprecated))
-                {
-                    // Skip this property if it's not a parameter
-                    if (!func_prop->HasAnyPropertyFlags(Unreal::EPropertyFlags::CPF_Parm))
-                    {
-                        continue;
-                    }
-
-                    // Skip if this property corresponds to the return value
-                    if (lua_data.has_return_value && func_prop->GetOffset_Internal() == return_value_offset)
-                    {
-                        lua_data.return_property = func_prop;
-                        continue;
-                    }
-
-                    Unreal::FName property_type = func_prop->GetClass().GetFName();
-                    int32_t name_comparison_index = property_type.GetComparisonIndex();
-
-                    if (LuaType::StaticState::m_property_value_pushers.contains(name_comparison_index))
-                    {
-                        // Non-typed pointer to the current parameter value
-                        void* data{};
-                        if (func_prop->HasAnyPropertyFlags(Unreal::EPropertyFlags::CPF_OutParm))
-                        {
-                            // For out params (including ref params), get the modified value from OutParms
-                            data = Unreal::FindOutParamValueAddress(context.TheStack, func_prop);
-                        }
-                        else
-                        {
-                            // For regular input params, read from Locals
-                            data = func_prop->ContainerPtrToValuePtr<void>(context.TheStack.Locals());
-                        }
-
-                        // Keeping track of where in the 'Locals' array the next property is
-                        // current_param_offset += func_prop->GetSize();
-
-                        // Set up a call to a handler for this type of Unreal property (the param)
-                        // The FName is being used as a key for an unordered_map which has the types & corresponding handlers filled right after the dll is injected
-                        const LuaType::PusherParams pusher_params{.operation = LuaType::Operation::GetParam,
-                                                                  .lua = lua_data.lua,
-                                                                  .base = nullptr,
-                                                                  .data = data,
-                                                                  .property = func_prop};
-                        LuaType::StaticState::m_property_value_pushers[name_comparison_index](pusher_params);
-                    }
-                    else
-                    {
-                        lua_data.lua.throw_error(fmt::format(
-                                "[unreal_script_function_hook] Tried accessing unreal property without a registered handler. Property type '{}' not supported.",
-                                to_string(property_type.ToString())));
-                    }
-                }
+                push_hooked_function_params(lua_data, plan, context.TheStack);
             }
 
             // Call the Lua function with the correct number of parameters & return values
             // Increasing the 'num_params' by one to account for the 'this / context' param
             // Increasing it again if there's a return value because we store that as the second param
-            lua_data.lua.call_function(num_unreal_params + (lua_data.has_return_value ? 2 : 1), 1);
+            lua_data.lua.call_function(plan.num_unreal_params + (plan.has_return_value ? 2 : 1), 1);
         }
 
         // Processing potential return values from both callbacks.
@@ -595,6 +620,7 @@ namespace RC
         key_table.add_pair("ZOOM", static_cast<uint32_t>(Input::Key::ZOOM));
         key_table.add_pair("PA1", static_cast<uint32_t>(Input::Key::PA1));
         key_table.add_pair("OEM_CLEAR", static_cast<uint32_t>(Input::Key::OEM_CLEAR));
+        key_table.make_readonly();
         key_table.make_global("Key");
 
         LuaMadeSimple::Lua::Table modifier_key_table = lua.prepare_new_table();
@@ -607,6 +633,7 @@ namespace RC
         modifier_key_table.add_pair("RIGHT_CONTROL", 0xA3);
         modifier_key_table.add_pair("LEFT_ALT", 0xA4);
         modifier_key_table.add_pair("RIGHT_ALT", 0xA5);*/
+        modifier_key_table.make_readonly();
         modifier_key_table.make_global("ModifierKey");
     }
 
@@ -653,6 +680,7 @@ namespace RC
         object_flags_table.add_pair("RF_HasExternalPackage",
                                     static_cast<std::underlying_type_t<Unreal::EObjectFlags>>(Unreal::EObjectFlags::RF_HasExternalPackage));
         object_flags_table.add_pair("RF_AllFlags", static_cast<std::underlying_type_t<Unreal::EObjectFlags>>(Unreal::EObjectFlags::RF_AllFlags));
+        object_flags_table.make_readonly();
         object_flags_table.make_global("EObjectFlags");
 
         LuaMadeSimple::Lua::Table object_internal_flags_table = lua.prepare_new_table();
@@ -673,6 +701,7 @@ namespace RC
                                              static_cast<std::underlying_type_t<Unreal::EInternalObjectFlags>>(
                                                      Unreal::EInternalObjectFlags::GarbageCollectionKeepFlags));
         object_internal_flags_table.add_pair("AllFlags", static_cast<std::underlying_type_t<Unreal::EInternalObjectFlags>>(Unreal::EInternalObjectFlags::AllFlags));
+        object_internal_flags_table.make_readonly();
         object_internal_flags_table.make_global("EInternalObjectFlags");
     }
 
@@ -683,6 +712,7 @@ namespace RC
         efindname_table.add_pair("FNAME_Add", static_cast<std::underlying_type_t<Unreal::EFindName>>(Unreal::EFindName::FNAME_Add));
         efindname_table.add_pair("FNAME_Replace_Not_Safe_For_Threading",
                                  static_cast<std::underlying_type_t<Unreal::EFindName>>(Unreal::EFindName::FNAME_Replace_Not_Safe_For_Threading));
+        efindname_table.make_readonly();
         efindname_table.make_global("EFindName");
     }
 
@@ -714,6 +744,26 @@ namespace RC
 
     auto LuaMod::global_uninstall() -> void
     {
+        // Every mod is gone, so no hook can still be reading a snapshot that was replaced while they were loaded
+        m_script_hook_names.free_retired();
+        m_static_construct_object_index.free_retired();
+        for (auto* callbacks : {&m_process_console_exec_pre_callbacks,
+                                &m_process_console_exec_post_callbacks,
+                                &m_call_function_by_name_with_arguments_pre_callbacks,
+                                &m_call_function_by_name_with_arguments_post_callbacks,
+                                &m_local_player_exec_pre_callbacks,
+                                &m_local_player_exec_post_callbacks,
+                                &m_load_map_pre_callbacks,
+                                &m_load_map_post_callbacks,
+                                &m_init_game_state_pre_callbacks,
+                                &m_init_game_state_post_callbacks,
+                                &m_begin_play_pre_callbacks,
+                                &m_begin_play_post_callbacks,
+                                &m_end_play_pre_callbacks,
+                                &m_end_play_post_callbacks})
+        {
+            callbacks->free_retired();
+        }
     }
 
     template <typename PropertyType>
@@ -884,6 +934,7 @@ namespace RC
             add_property_type_table<Unreal::FUtf8StrProperty>(lua, property_types_table, "Utf8StrProperty");
         }
 
+        property_types_table.make_readonly();
         property_types_table.make_global("PropertyTypes");
     }
 
@@ -1140,7 +1191,24 @@ namespace RC
 
     auto LuaMod::find_function_hook_data(std::vector<FunctionHookData>& container, const Unreal::UObject* object) -> FunctionHookData*
     {
-        return find_function_hook_data(container, get_object_names(object));
+        // Walks the outer chain for each entry instead of collecting it with 'get_object_names', this is called for every hooked Blueprint function call
+        for (auto& data : container)
+        {
+            auto ptr = object;
+            size_t index = 0;
+            for (; ptr && index < data.names.size(); ptr = ptr->GetOuterPrivate(), ++index)
+            {
+                if (!data.names[index].Equals(ptr->GetNamePrivate()))
+                {
+                    break;
+                }
+            }
+            if (!ptr && index == data.names.size())
+            {
+                return &data;
+            }
+        }
+        return nullptr;
     }
 
     auto LuaMod::find_function_hook_data(std::vector<FunctionHookData>& container, const std::vector<Unreal::FName>& in_name) -> FunctionHookData*
@@ -1167,6 +1235,52 @@ namespace RC
         return nullptr;
     }
 
+    auto LuaMod::rebuild_script_hook_index() -> void
+    {
+        auto script_hook_names = std::make_unique<std::unordered_set<Unreal::FName>>();
+        for (const auto* container : {&m_custom_event_callbacks, &m_script_hook_callbacks})
+        {
+            for (const auto& data : *container)
+            {
+                if (!data.names.empty())
+                {
+                    script_hook_names->emplace(data.names[0]);
+                }
+            }
+        }
+        m_script_hook_names.publish(script_hook_names->empty() ? nullptr : std::move(script_hook_names));
+    }
+
+    auto LuaMod::modify_static_construct_object_callbacks(const std::function<void(StaticConstructObjectCallbacks&)>& modifier) -> void
+    {
+        std::lock_guard<std::mutex> lock{m_static_construct_object_modify_mutex};
+        auto index = std::make_unique<StaticConstructObjectIndex>();
+        if (const auto current_index = m_static_construct_object_index.load())
+        {
+            index->callbacks = current_index->callbacks;
+        }
+        modifier(index->callbacks);
+
+        std::erase_if(index->callbacks, [](const auto& pair) {
+            return pair.second.empty();
+        });
+        for (const auto& [instance_of_class, callbacks] : index->callbacks)
+        {
+            if (instance_of_class)
+            {
+                index->class_filter.set(get_static_construct_object_filter_bit(instance_of_class));
+            }
+        }
+        m_static_construct_object_index.publish(index->callbacks.empty() ? nullptr : std::move(index));
+    }
+
+    auto LuaMod::get_static_construct_object_filter_bit(const Unreal::UStruct* ustruct) -> size_t
+    {
+        // Objects are at least 16 byte aligned so the low bits are always the same, Fibonacci hashing spreads the rest over the filter
+        constexpr auto filter_bits = std::bit_width(decltype(StaticConstructObjectIndex::class_filter){}.size()) - 1;
+        return static_cast<size_t>(((std::bit_cast<uintptr_t>(ustruct) >> 4) * 0x9E3779B97F4A7C15ull) >> (64 - filter_bits));
+    }
+
     auto LuaMod::remove_function_hook_data(std::vector<FunctionHookData>& container, StringViewType in_name) -> void
     {
         remove_function_hook_data(container, Unreal::FName(in_name, Unreal::FNAME_Add));
@@ -1212,6 +1326,357 @@ namespace RC
         }
     }
 
+    // 'LuaMod::m_actor_batches_mutex' must be locked
+    static auto add_pending_batched_actor(const Unreal::AActor* actor) -> void
+    {
+        ++LuaMod::m_pending_batched_actors[actor];
+    }
+
+    // 'LuaMod::m_actor_batches_mutex' must be locked
+    static auto remove_pending_batched_actors(const std::vector<Unreal::AActor*>& actors) -> void
+    {
+        for (const auto* actor : actors)
+        {
+            if (auto it = LuaMod::m_pending_batched_actors.find(actor); it != LuaMod::m_pending_batched_actors.end() && --it->second == 0)
+            {
+                LuaMod::m_pending_batched_actors.erase(it);
+            }
+        }
+    }
+
+    // 'LuaMod::m_actor_batches_mutex' must be locked
+    static auto update_pending_batched_actor_count() -> void
+    {
+        LuaMod::m_pending_batched_actor_count.store(LuaMod::m_pending_batched_actors.size(), std::memory_order_release);
+    }
+
+    static auto register_actor_batch_hook(const LuaMadeSimple::Lua& lua, std::vector<LuaMod::LuaActorBatchCallbackData>& batches, std::string_view function_name)
+            -> int64_t
+    {
+        std::string error_overload_not_found{fmt::format(R"(
+No overload found for function '{0}'.
+Overloads:
+#1: {0}(string UClassName, LuaFunction Callback))",
+                                                         function_name)};
+
+        if (!lua.is_string())
+        {
+            lua.throw_error(error_overload_not_found);
+        }
+
+        auto class_name = ensure_str(lua.get_string());
+
+        if (!lua.is_function())
+        {
+            lua.throw_error(error_overload_not_found);
+        }
+
+        // Batches are delivered from the engine tick, there's nothing else that runs once per frame on the game thread
+        if (!UE4SSRuntime::IsEngineTickAvailable())
+        {
+            lua.throw_error(fmt::format("{}: EngineTick hook is not available (AOB scan failed)", function_name));
+        }
+
+        Unreal::UClass* instance_of_class = Unreal::UObjectGlobals::StaticFindObject<Unreal::UClass*>(nullptr, nullptr, class_name);
+        if (!instance_of_class)
+        {
+            lua.throw_error(fmt::format("{}: Class '{}' was not found, it must be loaded before the hook is registered", function_name, to_string(class_name)));
+        }
+
+        auto mod = get_mod_ref(lua);
+        auto hook_lua = get_hook_lua(mod);
+
+        lua_xmove(lua.get_lua_state(), hook_lua->get_lua_state(), 1);
+
+        // Take a reference to the Lua function (it also pops it of the stack)
+        const int32_t lua_callback_registry_index = hook_lua->registry().make_ref();
+
+        int64_t callback_id{};
+        {
+            std::lock_guard<std::mutex> guard{LuaMod::m_actor_batches_mutex};
+            callback_id = LuaMod::m_next_actor_batch_callback_id++;
+            batches.emplace_back(LuaMod::LuaActorBatchCallbackData{
+                    .callback_id = callback_id,
+                    .lua = hook_lua,
+                    .instance_of_class = instance_of_class,
+                    .lua_callback_function_ref = lua_callback_registry_index,
+            });
+        }
+
+        std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
+        LuaMod::ensure_engine_tick_hooked();
+
+        return callback_id;
+    }
+
+    static auto unregister_actor_batch_hook(const LuaMadeSimple::Lua& lua, std::vector<LuaMod::LuaActorBatchCallbackData>& batches, std::string_view function_name)
+            -> void
+    {
+        std::string error_overload_not_found{fmt::format(R"(
+No overload found for function '{0}'.
+Overloads:
+#1: {0}(integer CallbackId))",
+                                                         function_name)};
+
+        if (!lua.is_integer())
+        {
+            lua.throw_error(error_overload_not_found);
+        }
+        const auto callback_id = lua.get_integer();
+
+        // Held for the unref, the callback's Lua state is used by the engine tick
+        std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
+        auto hook_lua = get_hook_lua(get_mod_ref(lua));
+
+        std::optional<int32_t> removed_function_ref{};
+        {
+            std::lock_guard<std::mutex> actor_batches_guard{LuaMod::m_actor_batches_mutex};
+            std::erase_if(batches, [&](const LuaMod::LuaActorBatchCallbackData& batch) {
+                if (batch.lua != hook_lua || batch.callback_id != callback_id)
+                {
+                    return false;
+                }
+                remove_pending_batched_actors(batch.pending_actors);
+                removed_function_ref = batch.lua_callback_function_ref;
+                return true;
+            });
+            update_pending_batched_actor_count();
+        }
+
+        if (removed_function_ref)
+        {
+            luaL_unref(hook_lua->get_lua_state(), LUA_REGISTRYINDEX, *removed_function_ref);
+        }
+    }
+
+    // Filters for 'FindAllOf', 'ForEachOf' and 'IterateAllOf'
+    // They're checked while searching, so that objects that don't match never get a Lua object
+    struct ObjectQuery
+    {
+        // Either a class or a short class name, which is looked up the same way as 'FindAllOf(string)' does it
+        Unreal::UClass* instance_of_class{};
+        StringType short_class_name{};
+        int64_t limit{};
+        int32_t required_flags{Unreal::EObjectFlags::RF_NoFlags};
+        int32_t banned_flags{Unreal::EObjectFlags::RF_NoFlags};
+        Unreal::UObject* outer{};
+        StringType name_prefix{};
+    };
+
+    // Objects found by 'IterateAllOf', owned by the iterator and handed to Lua one at a time
+    // Weak because the loop can yield or be kept around, and objects can be garbage collected in between
+    struct ObjectQueryResults
+    {
+        std::vector<Unreal::FWeakObjectPtr> objects{};
+        size_t next_index{};
+    };
+
+    // Takes the class (P1) and the optional table of filters (P2) off the stack
+    static auto parse_object_query(const LuaMadeSimple::Lua& lua, std::string_view function_name, const std::string& error_overload_not_found) -> ObjectQuery
+    {
+        ObjectQuery query{};
+
+        if (lua.is_string())
+        {
+            query.short_class_name = ensure_str(lua.get_string());
+        }
+        else if (lua.is_userdata())
+        {
+            // The API is a bit awkward, we have to tell it to preserve the stack
+            // That way, when we call 'get_userdata' again with a more specific type, there's still something to actually get
+            auto& userdata = lua.get_userdata<LuaType::UE4SSBaseObject>(1, true);
+            if (std::string_view{userdata.get_object_name()} != "UClass")
+            {
+                lua.throw_error(error_overload_not_found);
+            }
+            query.instance_of_class = lua.get_userdata<LuaType::UClass>().get_remote_cpp_object();
+        }
+        else
+        {
+            lua.throw_error(error_overload_not_found);
+        }
+
+        if (!lua.is_table())
+        {
+            return query;
+        }
+
+        // Errors aren't thrown from inside the loop, 'for_each_in_table' needs to finish to leave the stack and its state in order
+        std::string filter_error{};
+        lua.for_each_in_table([&](LuaMadeSimple::LuaTableReference table) -> bool {
+            if (!table.key.is_string())
+            {
+                filter_error = fmt::format("[{}] The filters table can only contain named filters", function_name);
+                return true;
+            }
+
+            const auto filter_name = table.key.get_string();
+            if (filter_name == "Limit" || filter_name == "RequiredFlags" || filter_name == "BannedFlags")
+            {
+                if (!table.value.is_integer())
+                {
+                    filter_error = fmt::format("[{}] Filter '{}' must be an integer", function_name, filter_name);
+                    return true;
+                }
+
+                const auto value = table.value.get_integer();
+                if (filter_name == "Limit")
+                {
+                    if (value < 0)
+                    {
+                        filter_error = fmt::format("[{}] Filter 'Limit' can't be negative", function_name);
+                        return true;
+                    }
+                    query.limit = value;
+                }
+                else if (filter_name == "RequiredFlags")
+                {
+                    query.required_flags = static_cast<int32_t>(value);
+                }
+                else
+                {
+                    query.banned_flags = static_cast<int32_t>(value);
+                }
+            }
+            else if (filter_name == "Outer")
+            {
+                // The value is at -2 while iterating a table
+                if (!lua.is_userdata(-2))
+                {
+                    filter_error = fmt::format("[{}] Filter 'Outer' must be a UObject", function_name);
+                    return true;
+                }
+
+                auto& userdata = lua.get_userdata<LuaType::UE4SSBaseObject>(-2, true);
+                std::string_view lua_object_name = userdata.get_object_name();
+                // TODO: Redo when there's a better way of checking whether a lua object is derived from UObject
+                if (lua_object_name == "UClass")
+                {
+                    query.outer = lua.get_userdata<LuaType::UClass>(-2, true).get_remote_cpp_object();
+                }
+                else if (lua_object_name == "UObject" || lua_object_name == "UWorld" || lua_object_name == "AActor")
+                {
+                    query.outer = lua.get_userdata<LuaType::UObject>(-2, true).get_remote_cpp_object();
+                }
+                else
+                {
+                    filter_error = fmt::format("[{}] Filter 'Outer' must be a UObject", function_name);
+                    return true;
+                }
+            }
+            else if (filter_name == "NamePrefix")
+            {
+                if (!table.value.is_string())
+                {
+                    filter_error = fmt::format("[{}] Filter 'NamePrefix' must be a string", function_name);
+                    return true;
+                }
+                query.name_prefix = ensure_str(table.value.get_string());
+            }
+            else
+            {
+                filter_error = fmt::format("[{}] Unknown filter '{}', the filters are Limit, RequiredFlags, BannedFlags, Outer and NamePrefix",
+                                           function_name,
+                                           filter_name);
+                return true;
+            }
+
+            return false;
+        });
+
+        if (!filter_error.empty())
+        {
+            lua.throw_error(filter_error);
+        }
+
+        return query;
+    }
+
+    // Both go through the object searcher, which only looks at instances of a class and its children
+    // A short class name is resolved to every class with that name first
+    static auto find_objects_matching(const ObjectQuery& query, std::vector<Unreal::UObject*>& out_objects) -> void
+    {
+        const auto required_flags = static_cast<Unreal::EObjectFlags>(query.required_flags);
+        const auto banned_flags = static_cast<Unreal::EObjectFlags>(query.banned_flags);
+        const auto add_if_matching = [&](Unreal::UObject* object) {
+            // Same as 'FindAllOf', default objects aren't instances
+            if (object->HasAnyFlags(Unreal::EObjectFlags::RF_ClassDefaultObject))
+            {
+                return LoopAction::Continue;
+            }
+            if (query.required_flags != Unreal::EObjectFlags::RF_NoFlags && !object->HasAllFlags(required_flags))
+            {
+                return LoopAction::Continue;
+            }
+            if (query.banned_flags != Unreal::EObjectFlags::RF_NoFlags && object->HasAnyFlags(banned_flags))
+            {
+                return LoopAction::Continue;
+            }
+            if (query.outer && object->GetOuterPrivate() != query.outer)
+            {
+                return LoopAction::Continue;
+            }
+            // Checked last since it's the only filter that has to build a string
+            if (!query.name_prefix.empty() && !object->GetName().starts_with(query.name_prefix))
+            {
+                return LoopAction::Continue;
+            }
+
+            out_objects.emplace_back(object);
+            if (query.limit > 0 && out_objects.size() >= static_cast<size_t>(query.limit))
+            {
+                return LoopAction::Break;
+            }
+            return LoopAction::Continue;
+        };
+
+        if (query.instance_of_class)
+        {
+            Unreal::FindObjectSearcher(query.instance_of_class, Unreal::AnySuperStruct::StaticClass()).ForEach(add_if_matching);
+        }
+        else if (!query.short_class_name.empty())
+        {
+            // A name that isn't in the name table can't be the name of a class
+            const auto class_name = Unreal::FName(query.short_class_name, Unreal::FNAME_Find);
+            if (class_name == Unreal::NAME_None)
+            {
+                return;
+            }
+
+            // Every class with that short name, whatever package it's in, like 'FindAllOf(string)'
+            std::vector<Unreal::UClass*> classes{};
+            Unreal::FindObjectSearcher<Unreal::UClass, Unreal::AnySuperStruct>().ForEach([&](Unreal::UObject* object) {
+                if (object->GetNamePrivate() == class_name)
+                {
+                    classes.emplace_back(static_cast<Unreal::UClass*>(object));
+                }
+                return LoopAction::Continue;
+            });
+
+            // Each class goes through the object searcher, so that 'Limit' stops the search instead of filtering every instance
+            for (auto* instance_of_class : classes)
+            {
+                // Instances of a child are already found through its parent
+                if (std::ranges::any_of(classes, [&](Unreal::UClass* other_class) {
+                        return other_class != instance_of_class && instance_of_class->IsChildOf(other_class);
+                    }))
+                {
+                    continue;
+                }
+
+                auto loop_action = LoopAction::Continue;
+                Unreal::FindObjectSearcher(instance_of_class, Unreal::AnySuperStruct::StaticClass()).ForEach([&](Unreal::UObject* object) {
+                    loop_action = add_if_matching(object);
+                    return loop_action;
+                });
+                if (loop_action == LoopAction::Break)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
     auto static setup_lua_global_functions_internal(const LuaMadeSimple::Lua& lua, Mod::IsTrueMod is_true_mod) -> void
     {
         lua.register_function("print", LuaLibrary::global_print);
@@ -1372,12 +1837,43 @@ Overloads:
             std::string error_overload_not_found{R"(
 No overload found for function 'FindAllOf'.
 Overloads:
-#1: FindAllOf(string short_class_name))"};
+#1: FindAllOf(string short_class_name)
+#2: FindAllOf(string short_class_name|UClass Class, table Filters))"};
+
+            // Overload #2
+            // P1: string short_name or UClass
+            // P2 (optional when P1 is a UClass): table Filters
+            if (lua.is_userdata() || lua.is_table(2))
+            {
+                const auto query = parse_object_query(lua, "FindAllOf", error_overload_not_found);
+
+                std::vector<Unreal::UObject*> found_unreal_objects;
+                find_objects_matching(query, found_unreal_objects);
+
+                if (!found_unreal_objects.empty())
+                {
+                    LuaMadeSimple::Lua::Table table = lua.prepare_new_table(static_cast<int32_t>(found_unreal_objects.size()));
+
+                    for (size_t i = 0; i < found_unreal_objects.size(); ++i)
+                    {
+                        table.add_key(i + 1);
+                        LuaType::auto_construct_object(lua, found_unreal_objects[i]);
+                        table.fuse_pair();
+                    }
 
+                    table.make_local();
+                }
+                else
+                {
+                    lua.set_nil();
+                }
+
+                return 1;
+            }
             // Overload #1
             // P1: string short_name
             // Ignores any params after P1
-            if (lua.is_string())
+            else if (lua.is_string())
             {
                 constexpr int32_t elements_to_reserve = 40;
 
@@ -2291,7 +2787,9 @@ Overloads:
 
             Unreal::UClass* instance_of_class = Unreal::UObjectGlobals::StaticFindObject<Unreal::UClass*>(nullptr, nullptr, class_name);
 
-            LuaMod::m_static_construct_object_lua_callbacks.emplace_back(LuaMod::LuaCancellableCallbackData{hook_lua, instance_of_class, func_ref, thread_ref});
+            LuaMod::modify_static_construct_object_callbacks([&](LuaMod::StaticConstructObjectCallbacks& callbacks) {
+                callbacks[instance_of_class].emplace_back(LuaMod::LuaCancellableCallbackData{hook_lua, instance_of_class, func_ref, thread_ref});
+            });
 
             return 0;
         });
@@ -2331,6 +2829,7 @@ Overloads:
                                 .instance_of_class = nullptr,
                                 .registry_indexes = {std::pair<const LuaMadeSimple::Lua*, LuaMod::LuaCallbackData::RegistryIndex>{&lua, {lua_callback_registry_index}}},
                         }});
+                LuaMod::rebuild_script_hook_index();
             }
 
             return 0;
@@ -2350,6 +2849,7 @@ Overloads:
             auto custom_event_name = ensure_str(lua.get_string());
 
             LuaMod::remove_function_hook_data(LuaMod::m_custom_event_callbacks, custom_event_name);
+            LuaMod::rebuild_script_hook_index();
 
             return 0;
         });
@@ -2373,7 +2873,7 @@ Overloads:
             // Take a reference to the lua function (it also pops it off the stack)
             const int32_t lua_callback_registry_index = hook_lua->registry().make_ref();
 
-            LuaMod::m_load_map_pre_callbacks.emplace_back(LuaMod::LuaCallbackData{
+            LuaMod::m_load_map_pre_callbacks.add(LuaMod::LuaCallbackData{
                     .lua = &lua,
                     .instance_of_class = nullptr,
                     .registry_indexes = {std::pair<const LuaMadeSimple::Lua*, LuaMod::LuaCallbackData::RegistryIndex>{&lua, lua_callback_registry_index}}});
@@ -2400,7 +2900,7 @@ Overloads:
             // Take a reference to the lua function (it also pops it off the stack)
             const int32_t lua_callback_registry_index = hook_lua->registry().make_ref();
 
-            LuaMod::m_load_map_post_callbacks.emplace_back(LuaMod::LuaCallbackData{
+            LuaMod::m_load_map_post_callbacks.add(LuaMod::LuaCallbackData{
                     .lua = &lua,
                     .instance_of_class = nullptr,
                     .registry_indexes = {std::pair<const LuaMadeSimple::Lua*, LuaMod::LuaCallbackData::RegistryIndex>{&lua, lua_callback_registry_index}}});
@@ -2427,7 +2927,7 @@ Overloads:
             // Take a reference to the Lua function (it also pops it of the stack)
             const int32_t lua_callback_registry_index = hook_lua->registry().make_ref();
 
-            LuaMod::m_init_game_state_pre_callbacks.emplace_back(LuaMod::LuaCallbackData{
+            LuaMod::m_init_game_state_pre_callbacks.add(LuaMod::LuaCallbackData{
                     .lua = &lua,
                     .instance_of_class = nullptr,
                     .registry_indexes = {std::pair<const LuaMadeSimple::Lua*, LuaMod::LuaCallbackData::RegistryIndex>{&lua, lua_callback_registry_index}},
@@ -2455,7 +2955,7 @@ Overloads:
             // Take a reference to the Lua function (it also pops it of the stack)
             const int32_t lua_callback_registry_index = hook_lua->registry().make_ref();
 
-            LuaMod::m_init_game_state_post_callbacks.emplace_back(LuaMod::LuaCallbackData{
+            LuaMod::m_init_game_state_post_callbacks.add(LuaMod::LuaCallbackData{
                     .lua = &lua,
                     .instance_of_class = nullptr,
                     .registry_indexes = {std::pair<const LuaMadeSimple::Lua*, LuaMod::LuaCallbackData::RegistryIndex>{&lua, lua_callback_registry_index}},
@@ -2483,7 +2983,7 @@ Overloads:
             // Take a reference to the Lua function (it also pops it of the stack)
             const int32_t lua_callback_registry_index = hook_lua->registry().make_ref();
 
-            LuaMod::m_begin_play_pre_callbacks.emplace_back(LuaMod::LuaCallbackData{
+            LuaMod::m_begin_play_pre_callbacks.add(LuaMod::LuaCallbackData{
                     .lua = &lua,
                     .instance_of_class = nullptr,
                     .registry_indexes = {std::pair<const LuaMadeSimple::Lua*, LuaMod::LuaCallbackData::RegistryIndex>{&lua, lua_callback_registry_index}},
@@ -2511,7 +3011,7 @@ Overloads:
             // Take a reference to the Lua function (it also pops it of the stack)
             const int32_t lua_callback_registry_index = hook_lua->registry().make_ref();
 
-            LuaMod::m_begin_play_post_callbacks.emplace_back(LuaMod::LuaCallbackData{
+            LuaMod::m_begin_play_post_callbacks.add(LuaMod::LuaCallbackData{
                     .lua = &lua,
                     .instance_of_class = nullptr,
                     .registry_indexes = {std::pair<const LuaMadeSimple::Lua*, LuaMod::LuaCallbackData::RegistryIndex>{&lua, lua_callback_registry_index}},
@@ -2539,7 +3039,7 @@ Overloads:
             // Take a reference to the Lua function (it also pops it of the stack)
             const int32_t lua_callback_registry_index = hook_lua->registry().make_ref();
 
-            LuaMod::m_end_play_pre_callbacks.emplace_back(LuaMod::LuaCallbackData{
+            LuaMod::m_end_play_pre_callbacks.add(LuaMod::LuaCallbackData{
                     .lua = &lua,
                     .instance_of_class = nullptr,
                     .registry_indexes = {std::pair<const LuaMadeSimple::Lua*, LuaMod::LuaCallbackData::RegistryIndex>{&lua, lua_callback_registry_index}},
@@ -2567,7 +3067,7 @@ Overloads:
             // Take a reference to the Lua function (it also pops it of the stack)
             const int32_t lua_callback_registry_index = hook_lua->registry().make_ref();
 
-            LuaMod::m_end_play_post_callbacks.emplace_back(LuaMod::LuaCallbackData{
+            LuaMod::m_end_play_post_callbacks.add(LuaMod::LuaCallbackData{
                     .lua = &lua,
                     .instance_of_class = nullptr,
                     .registry_indexes = {std::pair<const LuaMadeSimple::Lua*, LuaMod::LuaCallbackData::RegistryIndex>{&lua, lua_callback_registry_index}},
@@ -2576,6 +3076,26 @@ Overloads:
             return 0;
         });
 
+        lua.register_function("RegisterBeginPlayBatchHook", [](const LuaMadeSimple::Lua& lua) -> int {
+            lua.set_integer(register_actor_batch_hook(lua, LuaMod::m_begin_play_batch_callbacks, "RegisterBeginPlayBatchHook"));
+            return 1;
+        });
+
+        lua.register_function("RegisterEndPlayBatchHook", [](const LuaMadeSimple::Lua& lua) -> int {
+            lua.set_integer(register_actor_batch_hook(lua, LuaMod::m_end_play_batch_callbacks, "RegisterEndPlayBatchHook"));
+            return 1;
+        });
+
+        lua.register_function("UnregisterBeginPlayBatchHook", [](const LuaMadeSimple::Lua& lua) -> int {
+            unregister_actor_batch_hook(lua, LuaMod::m_begin_play_batch_callbacks, "UnregisterBeginPlayBatchHook");
+            return 0;
+        });
+
+        lua.register_function("UnregisterEndPlayBatchHook", [](const LuaMadeSimple::Lua& lua) -> int {
+            unregister_actor_batch_hook(lua, LuaMod::m_end_play_batch_callbacks, "UnregisterEndPlayBatchHook");
+            return 0;
+        });
+
         lua.register_function("IterateGameDirectories", [](const LuaMadeSimple::Lua& lua) -> int {
             std::string error_overload_not_found{R"(
 No overload found for function 'IterateGameDirectories'.
@@ -2921,9 +3441,7 @@ Overloads:
             }
             const int32_t lua_function_ref = lua.registry().make_ref();
 
-            mod->actions_lock();
-            mod->m_pending_actions.emplace_back(LuaMod::AsyncAction{lua_function_ref, LuaMod::ActionType::Immediate});
-            mod->actions_unlock();
+            mod->queue_async_action(LuaMod::AsyncAction{lua_function_ref, LuaMod::ActionType::Immediate});
 
             return 0;
         });
@@ -2948,14 +3466,12 @@ Overloads:
 
             auto mod = get_mod_ref(lua);
 
-            mod->actions_lock();
-            mod->m_pending_actions.emplace_back(LuaMod::AsyncAction{
+            mod->queue_async_action(LuaMod::AsyncAction{
                     lua_function_ref,
                     LuaMod::ActionType::Delayed,
                     std::chrono::steady_clock::now(),
                     delay,
             });
-            mod->actions_unlock();
             return 0;
         });
 
@@ -2979,14 +3495,12 @@ Overloads:
 
             auto mod = get_mod_ref(lua);
 
-            mod->actions_lock();
-            mod->m_pending_actions.emplace_back(LuaMod::AsyncAction{
+            mod->queue_async_action(LuaMod::AsyncAction{
                     lua_function_ref,
                     LuaMod::ActionType::Loop,
                     std::chrono::steady_clock::now(),
                     delay,
             });
-            mod->actions_unlock();
 
             return 0;
         });
@@ -3002,13 +3516,15 @@ Overloads:
                 throw std::runtime_error{error_overload_not_found};
             }
 
-            LuaMod::LuaCallbackData* callback = nullptr;
             auto mod = get_mod_ref(lua);
             auto hook_lua = get_hook_lua(mod);
-            callback = &LuaMod::m_process_console_exec_pre_callbacks.emplace_back(LuaMod::LuaCallbackData{hook_lua, nullptr, {}});
-            lua_xmove(lua.get_lua_state(), callback->lua->get_lua_state(), 1);
-            const int32_t lua_function_ref = callback->lua->registry().make_ref();
-            callback->registry_indexes.emplace_back(hook_lua, LuaMod::LuaCallbackData::RegistryIndex{lua_function_ref});
+            lua_xmove(lua.get_lua_state(), hook_lua->get_lua_state(), 1);
+            const int32_t lua_function_ref = hook_lua->registry().make_ref();
+            LuaMod::m_process_console_exec_pre_callbacks.add(LuaMod::LuaCallbackData{
+                    .lua = hook_lua,
+                    .instance_of_class = nullptr,
+                    .registry_indexes = {std::pair<const LuaMadeSimple::Lua*, LuaMod::LuaCallbackData::RegistryIndex>{hook_lua, {lua_function_ref}}},
+            });
             return 0;
         });
 
@@ -3023,13 +3539,15 @@ Overloads:
                 throw std::runtime_error{error_overload_not_found};
             }
 
-            LuaMod::LuaCallbackData* callback = nullptr;
             auto mod = get_mod_ref(lua);
             auto hook_lua = get_hook_lua(mod);
-            callback = &LuaMod::m_process_console_exec_post_callbacks.emplace_back(LuaMod::LuaCallbackData{hook_lua, nullptr, {}});
-            lua_xmove(lua.get_lua_state(), callback->lua->get_lua_state(), 1);
-            const int32_t lua_function_ref = callback->lua->registry().make_ref();
-            callback->registry_indexes.emplace_back(hook_lua, LuaMod::LuaCallbackData::RegistryIndex{lua_function_ref});
+            lua_xmove(lua.get_lua_state(), hook_lua->get_lua_state(), 1);
+            const int32_t lua_function_ref = hook_lua->registry().make_ref();
+            LuaMod::m_process_console_exec_post_callbacks.add(LuaMod::LuaCallbackData{
+                    .lua = hook_lua,
+                    .instance_of_class = nullptr,
+                    .registry_indexes = {std::pair<const LuaMadeSimple::Lua*, LuaMod::LuaCallbackData::RegistryIndex>{hook_lua, {lua_function_ref}}},
+            });
             return 0;
         });
 
@@ -3044,13 +3562,15 @@ Overloads:
                 throw std::runtime_error{error_overload_not_found};
             }
 
-            LuaMod::LuaCallbackData* callback = nullptr;
             auto mod = get_mod_ref(lua);
             auto hook_lua = get_hook_lua(mod);
-            callback = &LuaMod::m_call_function_by_name_with_arguments_pre_callbacks.emplace_back(LuaMod::LuaCallbackData{hook_lua, nullptr, {}});
-            lua_xmove(lua.get_lua_state(), callback->lua->get_lua_state(), 1);
-            const int32_t lua_function_ref = callback->lua->registry().make_ref();
-            callback->registry_indexes.emplace_back(hook_lua, LuaMod::LuaCallbackData::RegistryIndex{lua_function_ref});
+            lua_xmove(lua.get_lua_state(), hook_lua->get_lua_state(), 1);
+            const int32_t lua_function_ref = hook_lua->registry().make_ref();
+            LuaMod::m_call_function_by_name_with_arguments_pre_callbacks.add(LuaMod::LuaCallbackData{
+                    .lua = hook_lua,
+                    .instance_of_class = nullptr,
+                    .registry_indexes = {std::pair<const LuaMadeSimple::Lua*, LuaMod::LuaCallbackData::RegistryIndex>{hook_lua, {lua_function_ref}}},
+            });
             return 0;
         });
 
@@ -3065,13 +3585,15 @@ Overloads:
                 throw std::runtime_error{error_overload_not_found};
             }
 
-            LuaMod::LuaCallbackData* callback = nullptr;
             auto mod = get_mod_ref(lua);
             auto hook_lua = get_hook_lua(mod);
-            callback = &LuaMod::m_call_function_by_name_with_arguments_post_callbacks.emplace_back(LuaMod::LuaCallbackData{hook_lua, nullptr, {}});
-            lua_xmove(lua.get_lua_state(), callback->lua->get_lua_state(), 1);
-            const int32_t lua_function_ref = callback->lua->registry().make_ref();
-            callback->registry_indexes.emplace_back(hook_lua, LuaMod::LuaCallbackData::RegistryIndex{lua_function_ref});
+            lua_xmove(lua.get_lua_state(), hook_lua->get_lua_state(), 1);
+            const int32_t lua_function_ref = hook_lua->registry().make_ref();
+            LuaMod::m_call_function_by_name_with_arguments_post_callbacks.add(LuaMod::LuaCallbackData{
+                    .lua = hook_lua,
+                    .instance_of_class = nullptr,
+                    .registry_indexes = {std::pair<const LuaMadeSimple::Lua*, LuaMod::LuaCallbackData::RegistryIndex>{hook_lua, {lua_function_ref}}},
+            });
             return 0;
         });
 
@@ -3086,13 +3608,15 @@ Overloads:
                 throw std::runtime_error{error_overload_not_found};
             }
 
-            LuaMod::LuaCallbackData* callback = nullptr;
             auto mod = get_mod_ref(lua);
             auto hook_lua = get_hook_lua(mod);
-            callback = &LuaMod::m_local_player_exec_pre_callbacks.emplace_back(LuaMod::LuaCallbackData{hook_lua, nullptr, {}});
-            lua_xmove(lua.get_lua_state(), callback->lua->get_lua_state(), 1);
-            const int32_t lua_function_ref = callback->lua->registry().make_ref();
-            callback->registry_indexes.emplace_back(hook_lua, LuaMod::LuaCallbackData::RegistryIndex{lua_function_ref});
+            lua_xmove(lua.get_lua_state(), hook_lua->get_lua_state(), 1);
+            const int32_t lua_function_ref = hook_lua->registry().make_ref();
+            LuaMod::m_local_player_exec_pre_callbacks.add(LuaMod::LuaCallbackData{
+                    .lua = hook_lua,
+                    .instance_of_class = nullptr,
+                    .registry_indexes = {std::pair<const LuaMadeSimple::Lua*, LuaMod::LuaCallbackData::RegistryIndex>{hook_lua, {lua_function_ref}}},
+            });
             return 0;
         });
 
@@ -3107,13 +3631,15 @@ Overloads:
                 throw std::runtime_error{error_overload_not_found};
             }
 
-            LuaMod::LuaCallbackData* callback = nullptr;
             auto mod = get_mod_ref(lua);
             auto hook_lua = get_hook_lua(mod);
-            callback = &LuaMod::m_local_player_exec_post_callbacks.emplace_back(LuaMod::LuaCallbackData{hook_lua, nullptr, {}});
-            lua_xmove(lua.get_lua_state(), callback->lua->get_lua_state(), 1);
-            const int32_t lua_function_ref = callback->lua->registry().make_ref();
-            callback->registry_indexes.emplace_back(hook_lua, LuaMod::LuaCallbackData::RegistryIndex{lua_function_ref});
+            lua_xmove(lua.get_lua_state(), hook_lua->get_lua_state(), 1);
+            const int32_t lua_function_ref = hook_lua->registry().make_ref();
+            LuaMod::m_local_player_exec_post_callbacks.add(LuaMod::LuaCallbackData{
+                    .lua = hook_lua,
+                    .instance_of_class = nullptr,
+                    .registry_indexes = {std::pair<const LuaMadeSimple::Lua*, LuaMod::LuaCallbackData::RegistryIndex>{hook_lua, {lua_function_ref}}},
+            });
             return 0;
         });
 
@@ -3400,6 +3926,112 @@ Overloads:
             return 1;
         });
 
+        lua.register_function("ForEachOf", [](const LuaMadeSimple::Lua& lua) -> int {
+            std::string error_overload_not_found{R"(
+No overload found for function 'ForEachOf'.
+Overloads:
+#1: ForEachOf(string short_class_name|UClass Class, LuaFunction Callback)
+#2: ForEachOf(string short_class_name|UClass Class, table Filters, LuaFunction Callback))"};
+
+            const auto query = parse_object_query(lua, "ForEachOf", error_overload_not_found);
+
+            if (!lua.is_function())
+            {
+                lua.throw_error(error_overload_not_found);
+            }
+
+            // Everything is found before calling into Lua, the callback might create or destroy objects which changes what the searcher is iterating
+            // Kept as weak pointers for the same reason as 'IterateAllOf', the callback can destroy objects that haven't been handed to it yet
+            std::vector<Unreal::UObject*> found_unreal_objects;
+            find_objects_matching(query, found_unreal_objects);
+            std::vector<Unreal::FWeakObjectPtr> found_weak_objects{};
+            found_weak_objects.reserve(found_unreal_objects.size());
+            for (auto* object : found_unreal_objects)
+            {
+                found_weak_objects.emplace_back(object);
+            }
+
+            for (auto& weak_object : found_weak_objects)
+            {
+                // Objects that were deleted since the search are skipped
+                auto unreal_object = weak_object.Get();
+                if (!unreal_object)
+                {
+                    continue;
+                }
+
+                // Duplicate the Lua function so that we can use it in subsequent iterations of this loop (call_function pops the function from the stack)
+                lua_pushvalue(lua.get_lua_state(), 1);
+
+                LuaType::auto_construct_object(lua, unreal_object);
+
+                lua.call_function(1, 1);
+
+                // We explicitly specify index 2 because we duplicated the function earlier and that's located at index 1.
+                if (lua.is_bool(2) && lua.get_bool(2))
+                {
+                    break;
+                }
+                else
+                {
+                    // Discard the return value, otherwise the Lua stack is corrupted on the next iteration
+                    lua.discard_value(2);
+                }
+            }
+
+            return 0;
+        });
+
+        lua.register_function("IterateAllOf", [](const LuaMadeSimple::Lua& lua) -> int {
+            std::string error_overload_not_found{R"(
+No overload found for function 'IterateAllOf'.
+Overloads:
+#1: IterateAllOf(string short_class_name|UClass Class)
+#2: IterateAllOf(string short_class_name|UClass Class, table Filters))"};
+
+            const auto query = parse_object_query(lua, "IterateAllOf", error_overload_not_found);
+
+            // The results are kept alive by the iterator, and only get a Lua object when the loop reaches them
+            auto results = static_cast<ObjectQueryResults*>(lua_newuserdatadtor(lua.get_lua_state(), sizeof(ObjectQueryResults), [](void* userdata) {
+                static_cast<ObjectQueryResults*>(userdata)->~ObjectQueryResults();
+            }));
+            new (results) ObjectQueryResults();
+            std::vector<Unreal::UObject*> found_unreal_objects{};
+            find_objects_matching(query, found_unreal_objects);
+            results->objects.reserve(found_unreal_objects.size());
+            for (auto* object : found_unreal_objects)
+            {
+                results->objects.emplace_back(object);
+            }
+
+            lua_pushcclosure(
+                    lua.get_lua_state(),
+                    [](lua_State* lua_state) -> int {
+                        return TRY([&] {
+                            auto results = static_cast<ObjectQueryResults*>(lua_touserdata(lua_state, lua_upvalueindex(1)));
+                            while (results->next_index < results->objects.size())
+                            {
+                                // Objects that were deleted since the search are skipped
+                                auto object = results->objects[results->next_index++].Get();
+                                if (!object)
+                                {
+                                    continue;
+                                }
+
+                                const auto& lua = LuaMadeSimple::Lua(lua_state);
+                                LuaType::auto_construct_object(lua, object);
+                                return 1;
+                            }
+
+                            lua_pushnil(lua_state);
+                            return 1;
+                        });
+                    },
+                    1);
+
+            return 1;
+        });
+
         lua.register_function("FindObjects", [](const LuaMadeSimple::Lua& lua) -> int {
             std::string error_overload_not_found{R"(
 No overload found for function 'FindObjects'.
@@ -3669,77 +4301,141 @@ Overloads:
         });
     }
 
-    template <GameThreadExecutionMethod Executor>
-    static auto process_delayed_actions(std::vector<LuaMod::DelayedGameThreadAction>& actions) -> void
+    // Only the batch being delivered is taken out of the container, so actors in the other batches can still be removed if they're deleted by a callback
+    // A callback can also register or unregister batches, so the next batch is found by id rather than by index, which would skip one after an unregister
+    static auto process_actor_batches(std::vector<LuaMod::LuaActorBatchCallbackData>& batches, bool is_end_play) -> void
     {
-        const auto now = std::chrono::steady_clock::now();
-        std::erase_if(actions, [&](LuaMod::DelayedGameThreadAction& action) -> bool {
-            // Check if pending removal first - any executor can clean up removed actions
-            // regardless of method, to avoid orphaned actions that never get cleaned up
-            if (action.status == LuaMod::DelayedActionStatus::PendingRemoval)
-            {
-                // Unref the function, but NOT the thread - the thread is shared across all actions
-                // and is anchored in the registry by ensure_hook_thread_exists
-                luaL_unref(action.lua->get_lua_state(), LUA_REGISTRYINDEX, action.lua_action_function_ref);
-                return true;
-            }
+        if (LuaMod::m_pending_batched_actor_count.load(std::memory_order_acquire) == 0)
+        {
+            return;
+        }
 
-            // Only handle actions matching the executor method
-            if constexpr (Executor == GameThreadExecutionMethod::ProcessEvent)
+        std::vector<Unreal::AActor*> actors{};
+        std::vector<int32_t> end_play_reasons{};
+        for (int64_t last_callback_id{};;)
+        {
+            const LuaMadeSimple::Lua* lua{};
+            int32_t lua_callback_function_ref{};
             {
-                if (action.method != GameThreadExecutionMethod::ProcessEvent)
+                std::lock_guard<std::mutex> guard{LuaMod::m_actor_batches_mutex};
+                auto batch_it = std::ranges::upper_bound(batches, last_callback_id, {}, &LuaMod::LuaActorBatchCallbackData::callback_id);
+                if (batch_it == batches.end())
                 {
-                    return false;
+                    break;
                 }
-            }
-            else if constexpr (Executor == GameThreadExecutionMethod::EngineTick)
-            {
-                if (action.method != GameThreadExecutionMethod::EngineTick)
+                auto& batch = *batch_it;
+                last_callback_id = batch.callback_id;
+                if (batch.pending_actors.empty())
                 {
-                    return false;
+                    continue;
                 }
+                lua = batch.lua;
+                lua_callback_function_ref = batch.lua_callback_function_ref;
+                actors.swap(batch.pending_actors);
+                end_play_reasons.swap(batch.pending_end_play_reasons);
+                remove_pending_batched_actors(actors);
+                update_pending_batched_actor_count();
             }
 
-            // Skip paused actions
-            if (action.status == LuaMod::DelayedActionStatus::Paused)
-            {
-                return false;
-            }
+            TRY([&] {
+                lua->registry().get_function_ref(lua_callback_function_ref);
 
-            // Check if ready to execute
-            bool ready = false;
-            if (action.method == GameThreadExecutionMethod::EngineTick && action.delay_frames > 0)
-            {
-                // Frame-based delay
-                action.frames_remaining--;
-                ready = action.frames_remaining <= 0;
-            }
-            else if (action.method != GameThreadExecutionMethod::EngineTick && action.delay_frames > 0)
-            {
-                // Skip frame-based delays - they can only be processed by EngineTick
-                // This should never happen since frame-based functions error if EngineTick unavailable
-                if (action.delay_frames > 0)
+                auto actors_table = lua->prepare_new_table(static_cast<int32_t>(actors.size()));
+                for (size_t count{}; const auto& actor : actors)
                 {
-                    Output::send<LogLevel::Warning>(STR("ProcessEvent hook received frame-based delayed action - this should not happen\n"));
-                    return false;
+                    ++count;
+                    actors_table.add_key(count);
+                    LuaType::auto_construct_object(*lua, actor);
+                    actors_table.fuse_pair();
                 }
-            }
-            else
+
+                if (is_end_play)
+                {
+                    auto reasons_table = lua->prepare_new_table(static_cast<int32_t>(end_play_reasons.size()));
+                    for (size_t count{}; const auto& reason : end_play_reasons)
+                    {
+                        ++count;
+                        reasons_table.add_key(count);
+                        lua->set_integer(reason);
+                        reasons_table.fuse_pair();
+                    }
+                }
+
+                lua->call_function(is_end_play ? 2 : 1, 0);
+            });
+
+            // Cleared rather than freed so the capacity is handed back to the next batch that's swapped out
+            actors.clear();
+            end_play_reasons.clear();
+        }
+    }
+
+    struct FActorBatchDeleteListener : public Unreal::FUObjectDeleteListener
+    {
+        static FActorBatchDeleteListener s_actor_batch_delete_listener;
+
+        void NotifyUObjectDeleted(const Unreal::UObjectBase* object, [[maybe_unused]] int32_t index) override
+        {
+            // Called for every object that's deleted, so this needs to be cheap when nothing is batched
+            if (LuaMod::m_pending_batched_actor_count.load(std::memory_order_acquire) == 0)
             {
-                // Time-based delay
-                ready = now >= action.execute_at;
+                return;
             }
 
-            if (!ready)
+            std::lock_guard<std::mutex> guard{LuaMod::m_actor_batches_mutex};
+            auto pending_it = LuaMod::m_pending_batched_actors.find(object);
+            if (pending_it == LuaMod::m_pending_batched_actors.end())
             {
-                return false;
+                return;
             }
+            LuaMod::m_pending_batched_actors.erase(pending_it);
+            update_pending_batched_actor_count();
 
-            if (LuaMod::m_is_currently_executing_game_action)
+            for (auto* batches : {&LuaMod::m_begin_play_batch_callbacks, &LuaMod::m_end_play_batch_callbacks})
             {
-                return false;
+                for (auto& batch : *batches)
+                {
+                    auto& actors = batch.pending_actors;
+                    auto& end_play_reasons = batch.pending_end_play_reasons;
+                    size_t kept{};
+                    for (size_t i = 0; i < actors.size(); ++i)
+                    {
+                        if (static_cast<const Unreal::UObjectBase*>(actors[i]) == object)
+                        {
+                            continue;
+                        }
+                        actors[kept] = actors[i];
+                        if (!end_play_reasons.empty())
+                        {
+                            end_play_reasons[kept] = end_play_reasons[i];
+                        }
+                        ++kept;
+                    }
+                    actors.resize(kept);
+                    if (!end_play_reasons.empty())
+                    {
+                        end_play_reasons.resize(kept);
+                    }
+                }
             }
+        }
+
+        void OnUObjectArrayShutdown() override
+        {
+            Unreal::UObjectArray::RemoveUObjectDeleteListener(this);
+        }
+    };
+    FActorBatchDeleteListener FActorBatchDeleteListener::s_actor_batch_delete_listener{};
+
+    template <GameThreadExecutionMethod Executor>
+    static auto process_delayed_actions(DelayedActionScheduler& scheduler) -> void
+    {
+        if (LuaMod::m_is_currently_executing_game_action)
+        {
+            return;
+        }
 
+        scheduler.process(Executor, [](const LuaMod::DelayedGameThreadAction& action) {
             LuaMod::m_is_currently_executing_game_action = true;
 
             action.lua->registry().get_function_ref(action.lua_action_function_ref);
@@ -3749,29 +4445,20 @@ Overloads:
             });
 
             LuaMod::m_is_currently_executing_game_action = false;
-
-            // Handle looping
-            if (action.is_looping && action.status != LuaMod::DelayedActionStatus::PendingRemoval)
-            {
-                // Reset the timer/frame counter
-                if (action.method == GameThreadExecutionMethod::EngineTick && action.delay_frames > 0)
-                {
-                    action.frames_remaining = action.delay_frames;
-                }
-                else
-                {
-                    action.execute_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(action.delay_ms);
-                }
-                return false; // Keep in list
-            }
-
-            // Unref the function, but NOT the thread - the thread is shared across all actions
-            // and is anchored in the registry by ensure_hook_thread_exists
-            luaL_unref(action.lua->get_lua_state(), LUA_REGISTRYINDEX, action.lua_action_function_ref);
-            return true;
         });
     }
 
+    auto LuaMod::make_delayed_action_handle() -> int64_t
+    {
+        // Mods can pick their own handles, so the counter can run into one that's in use
+        auto handle = m_next_delayed_action_handle++;
+        while (m_delayed_game_thread_actions.find(handle))
+        {
+            handle = m_next_delayed_action_handle++;
+        }
+        return handle;
+    }
+
     auto static process_event_hook([[maybe_unused]] Unreal::UObject* Context,
                                    [[maybe_unused]] Unreal::UFunction* Function,
                                    [[maybe_unused]] void* Parms) -> void
@@ -3788,6 +4475,8 @@ Overloads:
 
         process_simple_actions(LuaMod::m_engine_tick_actions);
         process_delayed_actions<GameThreadExecutionMethod::EngineTick>(LuaMod::m_delayed_game_thread_actions);
+        process_actor_batches(LuaMod::m_begin_play_batch_callbacks, false);
+        process_actor_batches(LuaMod::m_end_play_batch_callbacks, true);
     }
 
     // Local convenience wrappers for Capabilities functions
@@ -3898,6 +4587,7 @@ Overloads:
                 if (!function_data)
                 {
                     function_data = &m_script_hook_callbacks.emplace_back(get_object_names(unreal_function), LuaCallbackData{hook_lua, nullptr, {}});
+                    rebuild_script_hook_index();
                 }
                 auto& callback_data = function_data->callback_data;
                 // Note that non-native hooks don't have a different id for the post-callback.
@@ -4074,13 +4764,10 @@ Overloads:
                 // Check if handle already exists
                 {
                     std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                    for (const auto& action : LuaMod::m_delayed_game_thread_actions)
+                    if (LuaMod::m_delayed_game_thread_actions.find(handle))
                     {
-                        if (action.handle == handle && action.status != LuaMod::DelayedActionStatus::PendingRemoval)
-                        {
-                            // Handle exists, do nothing (like UE's Delay node)
-                            return 0;
-                        }
+                        // Handle exists, do nothing (like UE's Delay node)
+                        return 0;
                     }
                 }
 
@@ -4097,12 +4784,11 @@ Overloads:
                 action.lua_action_thread_ref = lua_thread_registry_index;
                 action.method = method;
                 action.delay_ms = delay_ms;
-                action.execute_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(delay_ms);
                 action.handle = handle;
 
                 {
                     std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                    LuaMod::m_delayed_game_thread_actions.emplace_back(action);
+                    LuaMod::m_delayed_game_thread_actions.add(action);
                 }
 
                 return 0;
@@ -4123,12 +4809,11 @@ Overloads:
                 action.lua_action_thread_ref = lua_thread_registry_index;
                 action.method = method;
                 action.delay_ms = delay_ms;
-                action.execute_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(delay_ms);
-                action.handle = LuaMod::m_next_delayed_action_handle++;
 
                 {
                     std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                    LuaMod::m_delayed_game_thread_actions.emplace_back(action);
+                    action.handle = LuaMod::make_delayed_action_handle();
+                    LuaMod::m_delayed_game_thread_actions.add(action);
                 }
 
                 lua.set_integer(action.handle);
@@ -4187,17 +4872,13 @@ Overloads:
             // Check if an action with this handle already exists
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                for (auto& action : LuaMod::m_delayed_game_thread_actions)
+                if (auto action = LuaMod::m_delayed_game_thread_actions.find(handle))
                 {
-                    if (action.handle == handle && action.status != LuaMod::DelayedActionStatus::PendingRemoval)
-                    {
-                        // Reset the timer for the existing action
-                        action.delay_ms = delay_ms;
-                        action.execute_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(delay_ms);
-                        action.status = LuaMod::DelayedActionStatus::Active;  // Unpause if paused
-                        lua.set_integer(handle);
-                        return 1;
-                    }
+                    // Reset the timer for the existing action, this also unpauses it
+                    action->delay_ms = delay_ms;
+                    LuaMod::m_delayed_game_thread_actions.restart(*action);
+                    lua.set_integer(handle);
+                    return 1;
                 }
             }
 
@@ -4214,13 +4895,12 @@ Overloads:
             action.lua_action_thread_ref = lua_thread_registry_index;
             action.method = method;
             action.delay_ms = delay_ms;
-            action.execute_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(delay_ms);
             action.is_retriggerable = true;
             action.handle = handle;
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                LuaMod::m_delayed_game_thread_actions.emplace_back(action);
+                LuaMod::m_delayed_game_thread_actions.add(action);
             }
 
             return 0;
@@ -4259,12 +4939,11 @@ Overloads:
             action.lua_action_function_ref = func_ref;
             action.lua_action_thread_ref = lua_thread_registry_index;
             action.delay_frames = frames;
-            action.frames_remaining = frames;
-            action.handle = LuaMod::m_next_delayed_action_handle++;
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                LuaMod::m_delayed_game_thread_actions.emplace_back(action);
+                action.handle = LuaMod::make_delayed_action_handle();
+                LuaMod::m_delayed_game_thread_actions.add(action);
                 LuaMod::ensure_engine_tick_hooked();
             }
 
@@ -4330,13 +5009,12 @@ Overloads:
             action.lua_action_thread_ref = lua_thread_registry_index;
             action.method = method;
             action.delay_ms = delay_ms;
-            action.execute_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(delay_ms);
             action.is_looping = true;
-            action.handle = LuaMod::m_next_delayed_action_handle++;
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                LuaMod::m_delayed_game_thread_actions.emplace_back(action);
+                action.handle = LuaMod::make_delayed_action_handle();
+                LuaMod::m_delayed_game_thread_actions.add(action);
             }
 
             lua.set_integer(action.handle);
@@ -4377,13 +5055,12 @@ Overloads:
             action.lua_action_function_ref = func_ref;
             action.lua_action_thread_ref = lua_thread_registry_index;
             action.delay_frames = frames;
-            action.frames_remaining = frames;
             action.is_looping = true;
-            action.handle = LuaMod::m_next_delayed_action_handle++;
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                LuaMod::m_delayed_game_thread_actions.emplace_back(action);
+                action.handle = LuaMod::make_delayed_action_handle();
+                LuaMod::m_delayed_game_thread_actions.add(action);
                 LuaMod::ensure_engine_tick_hooked();
             }
 
@@ -4410,24 +5087,13 @@ Overloads:
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                for (auto& action : LuaMod::m_delayed_game_thread_actions)
+                auto action = LuaMod::m_delayed_game_thread_actions.find(handle);
+                // Only allow resetting actions owned by the calling mod
+                if (action && action->lua == mod_hook_lua)
                 {
-                    // Only allow resetting actions owned by the calling mod
-                    if (action.handle == handle && action.lua == mod_hook_lua && action.status != LuaMod::DelayedActionStatus::PendingRemoval)
-                    {
-                        // Reset the timer based on whether it's time-based or frame-based
-                        if (action.delay_frames > 0)
-                        {
-                            action.frames_remaining = action.delay_frames;
-                        }
-                        else
-                        {
-                            action.execute_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(action.delay_ms);
-                        }
-                        action.status = LuaMod::DelayedActionStatus::Active;  // Unpause if paused
-                        found = true;
-                        break;
-                    }
+                    // Restarts from the original time or frame delay, this also unpauses it
+                    LuaMod::m_delayed_game_thread_actions.restart(*action);
+                    found = true;
                 }
             }
 
@@ -4456,26 +5122,21 @@ Overloads:
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                for (auto& action : LuaMod::m_delayed_game_thread_actions)
+                auto action = LuaMod::m_delayed_game_thread_actions.find(handle);
+                // Only allow modifying actions owned by the calling mod
+                if (action && action->lua == mod_hook_lua)
                 {
-                    // Only allow modifying actions owned by the calling mod
-                    if (action.handle == handle && action.lua == mod_hook_lua && action.status != LuaMod::DelayedActionStatus::PendingRemoval)
+                    // Set new delay and reset the timer
+                    if (action->delay_frames > 0)
                     {
-                        // Set new delay and reset the timer
-                        if (action.delay_frames > 0)
-                        {
-                            action.delay_frames = new_delay;
-                            action.frames_remaining = new_delay;
-                        }
-                        else
-                        {
-                            action.delay_ms = new_delay;
-                            action.execute_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(new_delay);
-                        }
-                        action.status = LuaMod::DelayedActionStatus::Active;  // Unpause if paused
-                        found = true;
-                        break;
+                        action->delay_frames = new_delay;
+                    }
+                    else
+                    {
+                        action->delay_ms = new_delay;
                     }
+                    LuaMod::m_delayed_game_thread_actions.restart(*action);
+                    found = true;
                 }
             }
 
@@ -4502,25 +5163,13 @@ Overloads:
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                for (auto& action : LuaMod::m_delayed_game_thread_actions)
+                auto action = LuaMod::m_delayed_game_thread_actions.find(handle);
+                // Only allow pausing actions owned by the calling mod
+                if (action && action->lua == mod_hook_lua && action->status == LuaMod::DelayedActionStatus::Active)
                 {
-                    // Only allow pausing actions owned by the calling mod
-                    if (action.handle == handle && action.lua == mod_hook_lua && action.status == LuaMod::DelayedActionStatus::Active)
-                    {
-                        // Store remaining time before pausing
-                        auto now = std::chrono::steady_clock::now();
-                        if (action.execute_at > now)
-                        {
-                            action.time_remaining_ms = std::chrono::duration_cast<std::chrono::milliseconds>(action.execute_at - now).count();
-                        }
-                        else
-                        {
-                            action.time_remaining_ms = 0;
-                        }
-                        action.status = LuaMod::DelayedActionStatus::Paused;
-                        found = true;
-                        break;
-                    }
+                    // Stores the remaining time or frames before pausing
+                    LuaMod::m_delayed_game_thread_actions.pause(*action);
+                    found = true;
                 }
             }
 
@@ -4547,17 +5196,13 @@ Overloads:
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                for (auto& action : LuaMod::m_delayed_game_thread_actions)
+                auto action = LuaMod::m_delayed_game_thread_actions.find(handle);
+                // Only allow unpausing actions owned by the calling mod
+                if (action && action->lua == mod_hook_lua && action->status == LuaMod::DelayedActionStatus::Paused)
                 {
-                    // Only allow unpausing actions owned by the calling mod
-                    if (action.handle == handle && action.lua == mod_hook_lua && action.status == LuaMod::DelayedActionStatus::Paused)
-                    {
-                        // Restore execute_at from remaining time
-                        action.execute_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(action.time_remaining_ms);
-                        action.status = LuaMod::DelayedActionStatus::Active;
-                        found = true;
-                        break;
-                    }
+                    // Reschedules from the remaining time or frames
+                    LuaMod::m_delayed_game_thread_actions.unpause(*action);
+                    found = true;
                 }
             }
 
@@ -4584,15 +5229,12 @@ Overloads:
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                for (auto& action : LuaMod::m_delayed_game_thread_actions)
+                auto action = LuaMod::m_delayed_game_thread_actions.find(handle);
+                // Only allow cancelling actions owned by the calling mod
+                if (action && action->lua == mod_hook_lua)
                 {
-                    // Only allow cancelling actions owned by the calling mod
-                    if (action.handle == handle && action.lua == mod_hook_lua && action.status != LuaMod::DelayedActionStatus::PendingRemoval)
-                    {
-                        action.status = LuaMod::DelayedActionStatus::PendingRemoval;
-                        found = true;
-                        break;
-                    }
+                    LuaMod::m_delayed_game_thread_actions.cancel(*action);
+                    found = true;
                 }
             }
 
@@ -4617,14 +5259,7 @@ Overloads:
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                for (const auto& action : LuaMod::m_delayed_game_thread_actions)
-                {
-                    if (action.handle == handle && action.status != LuaMod::DelayedActionStatus::PendingRemoval)
-                    {
-                        valid = true;
-                        break;
-                    }
-                }
+                valid = LuaMod::m_delayed_game_thread_actions.find(handle) != nullptr;
             }
 
             lua.set_bool(valid);
@@ -4648,14 +5283,8 @@ Overloads:
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                for (const auto& action : LuaMod::m_delayed_game_thread_actions)
-                {
-                    if (action.handle == handle && action.status == LuaMod::DelayedActionStatus::Active)
-                    {
-                        active = true;
-                        break;
-                    }
-                }
+                auto action = LuaMod::m_delayed_game_thread_actions.find(handle);
+                active = action && action->status == LuaMod::DelayedActionStatus::Active;
             }
 
             lua.set_bool(active);
@@ -4679,14 +5308,8 @@ Overloads:
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                for (const auto& action : LuaMod::m_delayed_game_thread_actions)
-                {
-                    if (action.handle == handle && action.status == LuaMod::DelayedActionStatus::Paused)
-                    {
-                        paused = true;
-                        break;
-                    }
-                }
+                auto action = LuaMod::m_delayed_game_thread_actions.find(handle);
+                paused = action && action->status == LuaMod::DelayedActionStatus::Paused;
             }
 
             lua.set_bool(paused);
@@ -4710,34 +5333,30 @@ Overloads:
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                for (const auto& action : LuaMod::m_delayed_game_thread_actions)
+                if (auto action = LuaMod::m_delayed_game_thread_actions.find(handle))
                 {
-                    if (action.handle == handle && action.status != LuaMod::DelayedActionStatus::PendingRemoval)
+                    if (action->delay_frames > 0)
                     {
-                        if (action.delay_frames > 0)
-                        {
-                            // Frame-based: return frames remaining
-                            remaining = action.frames_remaining;
-                        }
-                        else if (action.status == LuaMod::DelayedActionStatus::Paused)
+                        // Frame-based: return frames remaining
+                        remaining = LuaMod::m_delayed_game_thread_actions.get_frames_remaining(*action);
+                    }
+                    else if (action->status == LuaMod::DelayedActionStatus::Paused)
+                    {
+                        // Paused: return stored remaining time
+                        remaining = action->time_remaining_ms;
+                    }
+                    else
+                    {
+                        // Active: calculate remaining time
+                        auto now = std::chrono::steady_clock::now();
+                        if (action->execute_at > now)
                         {
-                            // Paused: return stored remaining time
-                            remaining = action.time_remaining_ms;
+                            remaining = std::chrono::duration_cast<std::chrono::milliseconds>(action->execute_at - now).count();
                         }
                         else
                         {
-                            // Active: calculate remaining time
-                            auto now = std::chrono::steady_clock::now();
-                            if (action.execute_at > now)
-                            {
-                                remaining = std::chrono::duration_cast<std::chrono::milliseconds>(action.execute_at - now).count();
-                            }
-                            else
-                            {
-                                remaining = 0;
-                            }
+                            remaining = 0;
                         }
-                        break;
                     }
                 }
             }
@@ -4763,35 +5382,31 @@ Overloads:
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                for (const auto& action : LuaMod::m_delayed_game_thread_actions)
+                if (auto action = LuaMod::m_delayed_game_thread_actions.find(handle))
                 {
-                    if (action.handle == handle && action.status != LuaMod::DelayedActionStatus::PendingRemoval)
+                    if (action->delay_frames > 0)
                     {
-                        if (action.delay_frames > 0)
-                        {
-                            // Frame-based: return frames elapsed
-                            elapsed = action.delay_frames - action.frames_remaining;
-                        }
-                        else if (action.status == LuaMod::DelayedActionStatus::Paused)
+                        // Frame-based: return frames elapsed
+                        elapsed = action->delay_frames - LuaMod::m_delayed_game_thread_actions.get_frames_remaining(*action);
+                    }
+                    else if (action->status == LuaMod::DelayedActionStatus::Paused)
+                    {
+                        // Paused: calculate from stored remaining time
+                        elapsed = action->delay_ms - action->time_remaining_ms;
+                    }
+                    else
+                    {
+                        // Active: calculate elapsed time
+                        auto now = std::chrono::steady_clock::now();
+                        if (action->execute_at > now)
                         {
-                            // Paused: calculate from stored remaining time
-                            elapsed = action.delay_ms - action.time_remaining_ms;
+                            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(action->execute_at - now).count();
+                            elapsed = action->delay_ms - remaining;
                         }
                         else
                         {
-                            // Active: calculate elapsed time
-                            auto now = std::chrono::steady_clock::now();
-                            if (action.execute_at > now)
-                            {
-                                auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(action.execute_at - now).count();
-                                elapsed = action.delay_ms - remaining;
-                            }
-                            else
-                            {
-                                elapsed = action.delay_ms;
-                            }
+                            elapsed = action->delay_ms;
                         }
-                        break;
                     }
                 }
             }
@@ -4817,21 +5432,17 @@ Overloads:
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                for (const auto& action : LuaMod::m_delayed_game_thread_actions)
+                if (auto action = LuaMod::m_delayed_game_thread_actions.find(handle))
                 {
-                    if (action.handle == handle && action.status != LuaMod::DelayedActionStatus::PendingRemoval)
+                    if (action->delay_frames > 0)
                     {
-                        if (action.delay_frames > 0)
-                        {
-                            // Frame-based: return frames
-                            rate = action.delay_frames;
-                        }
-                        else
-                        {
-                            // Time-based: return ms
-                            rate = action.delay_ms;
-                        }
-                        break;
+                        // Frame-based: return frames
+                        rate = action->delay_frames;
+                    }
+                    else
+                    {
+                        // Time-based: return ms
+                        rate = action->delay_ms;
                     }
                 }
             }
@@ -4853,16 +5464,7 @@ Overloads:
 
             {
                 std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
-                for (auto& action : LuaMod::m_delayed_game_thread_actions)
-                {
-                    // Check if this action belongs to the current mod by comparing hook lua states
-                    if (action.lua == mod_hook_lua && action.status != LuaMod::DelayedActionStatus::PendingRemoval)
-                    {
-                        // Mark for removal
-                        action.status = LuaMod::DelayedActionStatus::PendingRemoval;
-                        count++;
-                    }
-                }
+                count = LuaMod::m_delayed_game_thread_actions.cancel_all_for(mod_hook_lua);
             }
 
             lua.set_integer(count);
@@ -4876,7 +5478,8 @@ No overload found for function 'MakeActionHandle'.
 Overloads:
 #1: MakeActionHandle() -> integer Handle)"};
 
-            lua.set_integer(m_next_delayed_action_handle++);
+            std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
+            lua.set_integer(LuaMod::make_delayed_action_handle());
 
             return 1;
         });
@@ -5323,12 +5926,139 @@ Overloads:
         }
     }
 
+    static auto read_script_file(const std::filesystem::path& script_path, std::string& out_source) -> bool
+    {
+        std::ifstream file(script_path, std::ios::binary);
+        if (!file.is_open())
+        {
+            return false;
+        }
+        file.seekg(0, std::ios::end);
+        out_source.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0, std::ios::beg);
+        return static_cast<bool>(file.read(out_source.data(), static_cast<std::streamsize>(out_source.size())));
+    }
+
+    // Finds 'require("name")', 'require "name"' and 'require 'name'' calls
+    // Anything else, like a name built at runtime, is simply compiled when it's required
+    static auto find_literal_requires(std::string_view source) -> std::vector<std::string>
+    {
+        constexpr std::string_view require_keyword = "require";
+        const auto is_identifier_char = [](char c) {
+            return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+        };
+        const auto skip_whitespace = [&](size_t pos) {
+            while (pos < source.size() && std::isspace(static_cast<unsigned char>(source[pos])))
+            {
+                ++pos;
+            }
+            return pos;
+        };
+
+        std::vector<std::string> module_names{};
+        for (size_t pos = source.find(require_keyword); pos != std::string_view::npos; pos = source.find(require_keyword, pos))
+        {
+            const auto keyword_start = pos;
+            pos += require_keyword.size();
+            // Calls like 'package.require' or 'obj:require' aren't the global require
+            if (keyword_start > 0 && (is_identifier_char(source[keyword_start - 1]) || source[keyword_start - 1] == '.' || source[keyword_start - 1] == ':'))
+            {
+                continue;
+            }
+
+            pos = skip_whitespace(pos);
+            if (pos < source.size() && source[pos] == '(')
+            {
+                pos = skip_whitespace(pos + 1);
+            }
+            if (pos >= source.size() || (source[pos] != '"' && source[pos] != '\''))
+            {
+                continue;
+            }
+
+            const auto quote = source[pos++];
+            const auto name_end = source.find_first_of(std::string_view{quote == '"' ? "\"\\\n" : "'\\\n"}, pos);
+            // Names with escape sequences aren't worth decoding here
+            if (name_end == std::string_view::npos || source[name_end] != quote || name_end == pos)
+            {
+                continue;
+            }
+            module_names.emplace_back(source.substr(pos, name_end - pos));
+            pos = name_end + 1;
+        }
+        return module_names;
+    }
+
+    auto LuaMod::precompile_scripts() -> void
+    {
+        ScopedTimer timer{&m_compile_duration};
+        try
+        {
+            const auto precompile_file = [](const std::filesystem::path& script_path) -> std::string {
+                std::string source{};
+                if (!read_script_file(script_path, source))
+                {
+                    return {};
+                }
+                // Syntax errors are reported when the script is loaded, with the chunk name
+                LuauCompat::precompile(source);
+                return source;
+            };
+
+            // Same search order as 'custom_require_function'
+            const auto mods_path_str = normalize_path_for_lua(get_program().get_mods_directory());
+            const auto scripts_path_str = normalize_path_for_lua(m_scripts_path);
+            const auto resolve_module = [&](const std::string& module_name) -> std::filesystem::path {
+                for (const auto& path : {scripts_path_str + "/" + module_name + ".lua",
+                                         mods_path_str + "/shared/" + module_name + ".lua",
+                                         mods_path_str + "/shared/" + module_name + "/" + module_name + ".lua"})
+                {
+                    std::filesystem::path wide_path = utf8_to_wpath(path);
+                    if (std::error_code ec{}; std::filesystem::exists(wide_path, ec))
+                    {
+                        return wide_path;
+                    }
+                }
+                return {};
+            };
+
+            std::unordered_set<std::string> visited_modules{};
+            std::vector<std::string> sources_to_scan{};
+            sources_to_scan.emplace_back(precompile_file(m_scripts_path / STR("main.lua")));
+            while (!sources_to_scan.empty())
+            {
+                const auto source = std::move(sources_to_scan.back());
+                sources_to_scan.pop_back();
+                for (auto& module_name : find_literal_requires(source))
+                {
+                    if (!visited_modules.emplace(module_name).second)
+                    {
+                        continue;
+                    }
+                    if (auto module_path = resolve_module(module_name); !module_path.empty())
+                    {
+                        sources_to_scan.emplace_back(precompile_file(module_path));
+                    }
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            // Nothing is lost, whatever wasn't compiled here is compiled when it's loaded
+            Output::send<LogLevel::Warning>(STR("Failed to precompile scripts for mod '{}': {}\n"), get_name(), ensure_str(e.what()));
+        }
+    }
+
     auto LuaMod::start_mod() -> void
     {
         try
         {
             m_main_thread_id = std::this_thread::get_id();
 
+            double setup_duration{};
+            double execute_duration{};
+            ScopedTimer setup_timer{&setup_duration};
+
             prepare_mod(lua());
             make_main_state(this, lua());
             setup_lua_global_functions_main_state_only();
@@ -5340,16 +6070,27 @@ Overloads:
 
             // Set up the custom module loader for handling UTF-8 paths
             setup_custom_module_loader(main_lua());
+            setup_timer.stop_timer();
 
             // Use the scripts path that was already determined in the constructor
             std::filesystem::path main_script_path = m_scripts_path / STR("main.lua");
 
             if (std::filesystem::exists(main_script_path))
             {
-                if (!load_and_execute_script(main_script_path))
                 {
-                    Output::send<LogLevel::Error>(STR("Failed to execute main script: {}\n"), ensure_str(main_script_path));
+                    ScopedTimer execute_timer{&execute_duration};
+                    if (!load_and_execute_script(main_script_path))
+                    {
+                        Output::send<LogLevel::Error>(STR("Failed to execute main script: {}\n"), ensure_str(main_script_path));
+                    }
                 }
+                // The compile phase ran ahead of time on a worker thread, it still counts towards how long the mod took to start
+                Output::send(STR("Mod '{}' started in {:.2f} ms (compile: {:.2f} ms, setup: {:.2f} ms, main.lua: {:.2f} ms)\n"),
+                             get_name(),
+                             (m_compile_duration + setup_duration + execute_duration) * 1000.0,
+                             m_compile_duration * 1000.0,
+                             setup_duration * 1000.0,
+                             execute_duration * 1000.0);
             }
             else
             {
@@ -5403,6 +6144,14 @@ Overloads:
         }
     }
 
+    template <typename CallbackType>
+    static auto erase_from_container(LuaMod* mod, CallbackList<CallbackType>& container) -> void
+    {
+        container.erase_if([&](const CallbackType& data) {
+            return get_mod_ref(*data.lua) == mod;
+        });
+    }
+
     auto LuaMod::uninstall() -> void
     {
         // ProcessEvent hook may try to run, and the lua state will not be valid
@@ -5418,7 +6167,12 @@ Overloads:
             m_async_thread.join();
         }
 
-        erase_from_container(this, m_static_construct_object_lua_callbacks);
+        modify_static_construct_object_callbacks([&](StaticConstructObjectCallbacks& callbacks_by_class) {
+            for (auto& [instance_of_class, callbacks] : callbacks_by_class)
+            {
+                erase_from_container(this, callbacks);
+            }
+        });
         erase_from_container(this, m_process_console_exec_pre_callbacks);
         erase_from_container(this, m_process_console_exec_post_callbacks);
         erase_from_container(this, m_global_command_lua_callbacks);
@@ -5430,11 +6184,30 @@ Overloads:
         erase_from_container(this, m_init_game_state_post_callbacks);
         erase_from_container(this, m_begin_play_pre_callbacks);
         erase_from_container(this, m_begin_play_post_callbacks);
+        erase_from_container(this, m_end_play_pre_callbacks);
+        erase_from_container(this, m_end_play_post_callbacks);
+        {
+            std::lock_guard<std::mutex> actor_batches_guard{m_actor_batches_mutex};
+            for (const auto* batches : {&m_begin_play_batch_callbacks, &m_end_play_batch_callbacks})
+            {
+                for (const auto& batch : *batches)
+                {
+                    if (get_mod_ref(*batch.lua) == this)
+                    {
+                        remove_pending_batched_actors(batch.pending_actors);
+                    }
+                }
+            }
+            erase_from_container(this, m_begin_play_batch_callbacks);
+            erase_from_container(this, m_end_play_batch_callbacks);
+            update_pending_batched_actor_count();
+        }
         erase_from_container(this, m_call_function_by_name_with_arguments_pre_callbacks);
         erase_from_container(this, m_call_function_by_name_with_arguments_post_callbacks);
         erase_from_container(this, m_local_player_exec_pre_callbacks);
         erase_from_container(this, m_local_player_exec_post_callbacks);
         erase_from_container(this, m_script_hook_callbacks);
+        rebuild_script_hook_index();
 
         UE4SSProgram::get_program().get_all_input_events([&](auto& key_set) {
             std::erase_if(key_set.key_data,
@@ -5484,9 +6257,7 @@ Overloads:
         });
 
         // Remove any delayed game thread actions for this mod
-        std::erase_if(m_delayed_game_thread_actions, [&](const DelayedGameThreadAction& action) {
-            return action.lua == m_hook_lua;
-        });
+        m_delayed_game_thread_actions.remove_all_for(m_hook_lua);
 
         if (m_hook_lua != nullptr)
         {
@@ -5564,6 +6335,15 @@ Overloads:
 
     static auto script_hook([[maybe_unused]] Unreal::UObject* Context, Unreal::FFrame& Stack, [[maybe_unused]] void* RESULT_DECL) -> void
     {
+        // Both custom events and script hooks can only match a function with the same name as the one they were registered for
+        // The lock is only taken for those, every other Blueprint function call returns here without contending with the game thread
+        if (const auto script_hook_names = LuaMod::m_script_hook_names.load();
+            !script_hook_names || !script_hook_names->contains(Stack.Node()->GetNamePrivate()))
+        {
+            return;
+        }
+
+        // The containers can have changed since the snapshot was taken, they're searched again under the lock
         std::lock_guard<std::recursive_mutex> guard{LuaMod::m_thread_actions_mutex};
 
         auto execute_hook = [&](std::vector<LuaMod::FunctionHookData>& callback_container, bool precise_name_match) {
@@ -5615,8 +6395,7 @@ Overloads:
 
                             auto param_type = param->GetClass().GetFName();
                             auto param_type_comparison_index = param_type.GetComparisonIndex();
-                            if (auto it = LuaType::StaticState::m_property_value_pushers.find(param_type_comparison_index);
-                                it != LuaType::StaticState::m_property_value_pushers.end())
+                            if (auto type_handler = LuaType::StaticState::m_property_value_pushers.find(param_type_comparison_index))
                             {
                                 void* data{};
                                 if (param->HasAnyPropertyFlags(Unreal::EPropertyFlags::CPF_OutParm))
@@ -5634,7 +6413,6 @@ Overloads:
                                         .data = data,
                                         .property = param,
                                 };
-                                auto& type_handler = it->second;
                                 type_handler(pusher_param);
                             }
                             else
@@ -5657,15 +6435,13 @@ Overloads:
                             auto return_property_type = return_property->GetClass().GetFName();
                             auto return_property_type_comparison_index = return_property_type.GetComparisonIndex();
 
-                            if (auto it = LuaType::StaticState::m_property_value_pushers.find(return_property_type_comparison_index);
-                                it != LuaType::StaticState::m_property_value_pushers.end())
+                            if (auto type_handler = LuaType::StaticState::m_property_value_pushers.find(return_property_type_comparison_index))
                             {
                                 const LuaType::PusherParams pusher_params{.operation = LuaType::Operation::Set,
                                                                           .lua = lua,
                                                                           .base = static_cast<Unreal::UObject*>(RESULT_DECL),
                                                                           .data = RESULT_DECL,
                                                                           .property = return_property};
-                                auto& type_handler = it->second;
                                 type_handler(pusher_params);
                                 return_value_handled = true;
                             }
@@ -5696,16 +6472,42 @@ Overloads:
         });
     }
 
+    static auto add_to_actor_batches(std::vector<LuaMod::LuaActorBatchCallbackData>& batches, Unreal::AActor* actor, bool is_end_play, int32_t end_play_reason)
+            -> void
+    {
+        std::lock_guard<std::mutex> guard{LuaMod::m_actor_batches_mutex};
+        if (batches.empty())
+        {
+            return;
+        }
+
+        for (auto& batch : batches)
+        {
+            if (!actor->IsA(batch.instance_of_class))
+            {
+                continue;
+            }
+            batch.pending_actors.emplace_back(actor);
+            add_pending_batched_actor(actor);
+            if (is_end_play)
+            {
+                batch.pending_end_play_reasons.emplace_back(end_play_reason);
+            }
+        }
+        update_pending_batched_actor_count();
+    }
+
     auto LuaMod::on_program_start() -> void
     {
         Unreal::UObjectArray::AddUObjectDeleteListener(&LuaType::FLuaObjectDeleteListener::s_lua_object_delete_listener);
+        Unreal::UObjectArray::AddUObjectDeleteListener(&FActorBatchDeleteListener::s_actor_batch_delete_listener);
 
         Unreal::Hook::RegisterLoadMapPreCallback(
                 [](Unreal::UEngine* Engine, Unreal::FWorldContext& WorldContext, Unreal::FURL URL, Unreal::UPendingNetGame* PendingGame, Unreal::FString& Error)
                         -> std::pair<bool, bool> {
                     return TRY([&] {
                         std::pair<bool, bool> return_value{};
-                        for (const auto& callback_data : m_load_map_pre_callbacks)
+                        for (const auto& callback_data : m_load_map_pre_callbacks.snapshot())
                         {
                             for (const auto& [lua_ptr, registry_index] : callback_data.registry_indexes)
                             {
@@ -5743,9 +6545,10 @@ Overloads:
         Unreal::Hook::RegisterLoadMapPostCallback(
                 [](Unreal::UEngine* Engine, Unreal::FWorldContext& WorldContext, Unreal::FURL URL, Unreal::UPendingNetGame* PendingGame, Unreal::FString& Error)
                         -> std::pair<bool, bool> {
+                    s_marshalling_plan_generation.fetch_add(1, std::memory_order_release);
                     return TRY([&] {
                         std::pair<bool, bool> return_value{};
-                        for (const auto& callback_data : m_load_map_post_callbacks)
+                        for (const auto& callback_data : m_load_map_post_callbacks.snapshot())
                         {
                             for (const auto& [lua_ptr, registry_index] : callback_data.registry_indexes)
                             {
@@ -5782,7 +6585,7 @@ Overloads:
 
         Unreal::Hook::RegisterInitGameStatePreCallback([]([[maybe_unused]] Unreal::AGameModeBase* Context) {
             TRY([&] {
-                for (const auto& callback_data : m_init_game_state_pre_callbacks)
+                for (const auto& callback_data : m_init_game_state_pre_callbacks.snapshot())
                 {
                     for (const auto& [lua_ptr, registry_index] : callback_data.registry_indexes)
                     {
@@ -5799,7 +6602,7 @@ Overloads:
 
         Unreal::Hook::RegisterInitGameStatePostCallback([]([[maybe_unused]] Unreal::AGameModeBase* Context) {
             TRY([&] {
-                for (const auto& callback_data : m_init_game_state_post_callbacks)
+                for (const auto& callback_data : m_init_game_state_post_callbacks.snapshot())
                 {
                     for (const auto& [lua_ptr, registry_index] : callback_data.registry_indexes)
                     {
@@ -5816,7 +6619,7 @@ Overloads:
 
         Unreal::Hook::RegisterBeginPlayPreCallback([]([[maybe_unused]] Unreal::AActor* Context) {
             TRY([&] {
-                for (const auto& callback_data : m_begin_play_pre_callbacks)
+                for (const auto& callback_data : m_begin_play_pre_callbacks.snapshot())
                 {
                     for (const auto& [lua_ptr, registry_index] : callback_data.registry_indexes)
                     {
@@ -5833,7 +6636,9 @@ Overloads:
 
         Unreal::Hook::RegisterBeginPlayPostCallback([]([[maybe_unused]] Unreal::AActor* Context) {
             TRY([&] {
-                for (const auto& callback_data : m_begin_play_post_callbacks)
+                add_to_actor_batches(m_begin_play_batch_callbacks, Context, false, 0);
+
+                for (const auto& callback_data : m_begin_play_post_callbacks.snapshot())
                 {
                     for (const auto& [lua_ptr, registry_index] : callback_data.registry_indexes)
                     {
@@ -5850,7 +6655,9 @@ Overloads:
 
         Unreal::Hook::RegisterEndPlayPreCallback([]([[maybe_unused]] Unreal::AActor* Context, Unreal::EEndPlayReason EndPlayReason) {
             TRY([&] {
-                for (const auto& callback_data : m_end_play_pre_callbacks)
+                add_to_actor_batches(m_end_play_batch_callbacks, Context, true, static_cast<int32_t>(EndPlayReason));
+
+                for (const auto& callback_data : m_end_play_pre_callbacks.snapshot())
                 {
                     for (const auto& [lua_ptr, registry_index] : callback_data.registry_indexes)
                     {
@@ -5869,7 +6676,7 @@ Overloads:
 
         Unreal::Hook::RegisterEndPlayPostCallback([]([[maybe_unused]] Unreal::AActor* Context, Unreal::EEndPlayReason EndPlayReason) {
             TRY([&] {
-                for (const auto& callback_data : m_end_play_post_callbacks)
+                for (const auto& callback_data : m_end_play_post_callbacks.snapshot())
                 {
                     for (const auto& [lua_ptr, registry_index] : callback_data.registry_indexes)
                     {
@@ -5888,28 +6695,50 @@ Overloads:
 
         Unreal::Hook::RegisterStaticConstructObjectPostCallback([](const Unreal::FStaticConstructObjectParameters&, Unreal::UObject* constructed_object) {
             return TRY([&] {
+                // A callback can register or unregister callbacks, which publishes a new index, replaced indexes stay alive until mods are unloaded
+                const auto index = m_static_construct_object_index.load();
+                if (!index)
+                {
+                    return constructed_object;
+                }
+
                 Unreal::UStruct* object_class = constructed_object->GetClassPrivate();
                 while (object_class)
                 {
-                    std::erase_if(m_static_construct_object_lua_callbacks, [&](auto& callback_data) -> bool {
-                        bool cancel = false;
-                        if (callback_data.instance_of_class == object_class)
+                    if (!index->class_filter.test(get_static_construct_object_filter_bit(object_class)))
+                    {
+                        object_class = object_class->GetSuperStruct();
+                        continue;
+                    }
+
+                    if (auto callbacks_it = index->callbacks.find(static_cast<Unreal::UClass*>(object_class)); callbacks_it != index->callbacks.end())
+                    {
+                        for (const auto& callback_data : callbacks_it->second)
                         {
                             callback_data.lua->registry().get_function_ref(callback_data.lua_callback_function_ref);
                             LuaType::auto_construct_object(*callback_data.lua, constructed_object);
                             callback_data.lua->call_function(1, 1);
 
-                            cancel = callback_data.lua->is_bool(-1) && callback_data.lua->get_bool(-1);
-
-                            if (cancel)
+                            if (callback_data.lua->is_bool(-1) && callback_data.lua->get_bool(-1))
                             {
-                                // Release the thread_ref to GC.
-                                luaL_unref(callback_data.lua->get_lua_state(), LUA_REGISTRYINDEX, callback_data.lua_callback_thread_ref);
+                                bool was_removed{};
+                                modify_static_construct_object_callbacks([&](StaticConstructObjectCallbacks& callbacks_by_class) {
+                                    auto& callbacks = callbacks_by_class[callback_data.instance_of_class];
+                                    was_removed = std::erase_if(callbacks, [&](const LuaCancellableCallbackData& other) {
+                                                      return other.lua == callback_data.lua &&
+                                                             other.lua_callback_function_ref == callback_data.lua_callback_function_ref;
+                                                  }) > 0;
+                                });
+
+                                // Another thread can have removed it first if it returned true there as well
+                                if (was_removed)
+                                {
+                                    // Release the thread_ref to GC.
+                                    luaL_unref(callback_data.lua->get_lua_state(), LUA_REGISTRYINDEX, callback_data.lua_callback_thread_ref);
+                                }
                             }
                         }
-
-                        return cancel;
-                    });
+                    }
 
                     object_class = object_class->GetSuperStruct();
                 }
@@ -5921,7 +6750,7 @@ Overloads:
         Unreal::Hook::RegisterULocalPlayerExecPreCallback([](Unreal::ULocalPlayer* context, Unreal::UWorld* in_world, const TCHAR* cmd, Unreal::FOutputDevice& ar)
                                                                   -> Unreal::Hook::ULocalPlayerExecCallbackReturnValue {
             return TRY([&] {
-                for (const auto& callback_data : m_local_player_exec_pre_callbacks)
+                for (const auto& callback_data : m_local_player_exec_pre_callbacks.snapshot())
                 {
                     Unreal::Hook::ULocalPlayerExecCallbackReturnValue return_value{};
 
@@ -5977,7 +6806,7 @@ Overloads:
         Unreal::Hook::RegisterULocalPlayerExecPostCallback([](Unreal::ULocalPlayer* context, Unreal::UWorld* in_world, const TCHAR* cmd, Unreal::FOutputDevice& ar)
                                                                    -> Unreal::Hook::ULocalPlayerExecCallbackReturnValue {
             return TRY([&] {
-                for (const auto& callback_data : m_local_player_exec_post_callbacks)
+                for (const auto& callback_data : m_local_player_exec_post_callbacks.snapshot())
                 {
                     Unreal::Hook::ULocalPlayerExecCallbackReturnValue return_value{};
 
@@ -6035,7 +6864,7 @@ Overloads:
                         -> std::pair<bool, bool> {
                     return TRY([&] {
                         std::pair<bool, bool> return_value{};
-                        for (const auto& callback_data : m_call_function_by_name_with_arguments_pre_callbacks)
+                        for (const auto& callback_data : m_call_function_by_name_with_arguments_pre_callbacks.snapshot())
                         {
 
                             for (const auto& [lua, registry_index] : callback_data.registry_indexes)
@@ -6077,7 +6906,7 @@ Overloads:
                         -> std::pair<bool, bool> {
                     return TRY([&] {
                         std::pair<bool, bool> return_value{};
-                        for (const auto& callback_data : m_call_function_by_name_with_arguments_post_callbacks)
+                        for (const auto& callback_data : m_call_function_by_name_with_arguments_post_callbacks.snapshot())
                         {
 
                             for (const auto& [lua, registry_index] : callback_data.registry_indexes)
@@ -6212,7 +7041,7 @@ Overloads:
                         auto command_parts = explode_by_occurrence_with_quotes(command, STR(' '));
 
                         std::pair<bool, bool> return_value{};
-                        for (const auto& callback_data : m_process_console_exec_pre_callbacks)
+                        for (const auto& callback_data : m_process_console_exec_pre_callbacks.snapshot())
                         {
 
                             for (const auto& [lua, registry_index] : callback_data.registry_indexes)
@@ -6262,7 +7091,7 @@ Overloads:
                         auto command_parts = explode_by_occurrence_with_quotes(command, STR(' '));
 
                         std::pair<bool, bool> return_value{};
-                        for (const auto& callback_data : m_process_console_exec_post_callbacks)
+                        for (const auto& callback_data : m_process_console_exec_post_callbacks.snapshot())
                         {
                             for (const auto& [lua, registry_index] : callback_data.registry_indexes)
                             {
@@ -6423,19 +7252,42 @@ Overloads:
 
     auto LuaMod::update_async() -> void
     {
-        for (m_processing_events = true; m_processing_events && !m_async_thread.get_stop_token().stop_requested();)
+        const auto stop_token = m_async_thread.get_stop_token();
+        for (m_processing_events = true; m_processing_events && !stop_token.stop_requested();)
         {
-            if (m_pause_events_processing)
+            process_delayed_actions();
+
+            // Only this thread touches 'm_delayed_actions', so the next deadline can be found without the lock
+            auto next_deadline = std::chrono::steady_clock::time_point::max();
+            for (const auto& action : m_delayed_actions)
             {
-                continue;
+                next_deadline = std::min(next_deadline, action.created_at + std::chrono::milliseconds(action.delay));
             }
 
-            process_delayed_actions();
-
-            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            // Sleeps until an action is queued, the next delayed action is due, or the thread is asked to stop
+            std::unique_lock<std::mutex> lock{m_actions_lock};
+            const auto has_pending_actions = [&] {
+                return !m_pending_actions.empty();
+            };
+            if (next_deadline == std::chrono::steady_clock::time_point::max())
+            {
+                m_actions_cv.wait(lock, stop_token, has_pending_actions);
+            }
+            else
+            {
+                m_actions_cv.wait_until(lock, stop_token, next_deadline, has_pending_actions);
+            }
         }
     }
 
+    auto LuaMod::queue_async_action(AsyncAction action) -> void
+    {
+        actions_lock();
+        m_pending_actions.emplace_back(std::move(action));
+        actions_unlock();
+        m_actions_cv.notify_one();
+    }
+
     auto LuaMod::process_delayed_actions() -> void
     {
         auto now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
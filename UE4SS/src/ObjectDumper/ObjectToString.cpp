@@ -38,14 +38,17 @@ namespace RC::ObjectDumper
         return to_address(std::bit_cast<uintptr_t>(address));
     }
 
+    // These are called from multiple threads by the object dumper so they must never insert into the maps
     auto get_to_string(size_t hash) -> ObjectToStringDecl
     {
-        return object_to_string_functions[hash];
+        auto it = object_to_string_functions.find(hash);
+        return it == object_to_string_functions.end() ? nullptr : it->second;
     }
 
     auto get_to_string_complex(size_t hash) -> ObjectToStringComplexDecl
     {
-        return object_to_string_complex_functions[hash];
+        auto it = object_to_string_complex_functions.find(hash);
+        return it == object_to_string_complex_functions.end() ? nullptr : it->second;
     }
 
     auto to_string_exists(size_t hash) -> bool
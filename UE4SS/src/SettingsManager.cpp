@@ -98,6 +98,7 @@ namespace RC
         {
             General.DefaultExecuteInGameThreadMethod = GameThreadExecutionMethod::EngineTick;
         }
+        REGISTER_FLOAT_SETTING(General.DelayedActionTimeBudgetMs, section_general, DelayedActionTimeBudgetMs)
 
         constexpr static File::CharType section_engine_version_override[] = STR("EngineVersionOverride");
         REGISTER_INT64_SETTING(EngineVersionOverride.MajorVersion, section_engine_version_override, MajorVersion)
@@ -121,11 +122,36 @@ namespace RC
         REGISTER_BOOL_SETTING(UHTHeaderGenerator.MakeEnumClassesBlueprintType, section_uht_header_generator, MakeEnumClassesBlueprintType)
         REGISTER_BOOL_SETTING(UHTHeaderGenerator.MakeAllConfigsEngineConfig, section_uht_header_generator, MakeAllConfigsEngineConfig)
 
+        constexpr static File::CharType section_usmap_generator[] = STR("UsmapGenerator");
+        StringType usmap_compression_method_string{};
+        REGISTER_STRING_SETTING(usmap_compression_method_string, section_usmap_generator, CompressionMethod)
+        if (String::iequal(usmap_compression_method_string, STR("None")))
+        {
+            UsmapGenerator.CompressionMethod = OutTheShade::EUsmapCompressionMethod::None;
+        }
+        else if (String::iequal(usmap_compression_method_string, STR("Brotli")))
+        {
+            UsmapGenerator.CompressionMethod = OutTheShade::EUsmapCompressionMethod::Brotli;
+        }
+        else if (String::iequal(usmap_compression_method_string, STR("ZStandard")))
+        {
+            UsmapGenerator.CompressionMethod = OutTheShade::EUsmapCompressionMethod::ZStandard;
+        }
+        else if (!usmap_compression_method_string.empty())
+        {
+            UsmapGenerator.UnknownCompressionMethod = usmap_compression_method_string;
+        }
+
+        constexpr static File::CharType section_lua[] = STR("Lua");
+        REGISTER_BOOL_SETTING(Lua.CacheBytecodeOnDisk, section_lua, CacheBytecodeOnDisk)
+        REGISTER_BOOL_SETTING(Lua.EnableNativeCodeGen, section_lua, EnableNativeCodeGen)
+
         constexpr static File::CharType section_debug[] = STR("Debug");
         REGISTER_BOOL_SETTING(Debug.SimpleConsoleEnabled, section_debug, ConsoleEnabled)
         REGISTER_BOOL_SETTING(Debug.DebugConsoleEnabled, section_debug, GuiConsoleEnabled)
         REGISTER_BOOL_SETTING(Debug.DebugConsoleVisible, section_debug, GuiConsoleVisible)
         REGISTER_FLOAT_SETTING(Debug.DebugGUIFontScaling, section_debug, GuiConsoleFontScaling)
+        REGISTER_INT64_SETTING(Debug.AsyncLogFileFlushIntervalMs, section_debug, AsyncLogFileFlushIntervalMs)
         StringType graphics_api_string{};
         REGISTER_STRING_SETTING(graphics_api_string, section_debug, GraphicsAPI)
         if (String::iequal(graphics_api_string, STR("DX11")) || String::iequal(graphics_api_string, STR("D3D11")))
@@ -158,6 +184,20 @@ namespace RC
         constexpr static File::CharType section_threads[] = STR("Threads");
         REGISTER_INT64_SETTING(Threads.SigScannerNumThreads, section_threads, SigScannerNumThreads)
         REGISTER_INT64_SETTING(Threads.SigScannerMultithreadingModuleSizeThreshold, section_threads, SigScannerMultithreadingModuleSizeThreshold)
+        StringType scan_method_string{};
+        REGISTER_STRING_SETTING(scan_method_string, section_threads, SigScannerScanMethod)
+        if (String::iequal(scan_method_string, STR("StdFind")))
+        {
+            Threads.SigScannerScanMethod = SinglePassScanner::ScanMethod::StdFind;
+        }
+        else if (String::iequal(scan_method_string, STR("MultiPattern")))
+        {
+            Threads.SigScannerScanMethod = SinglePassScanner::ScanMethod::MultiPattern;
+        }
+        else if (String::iequal(scan_method_string, STR("Scalar")))
+        {
+            Threads.SigScannerScanMethod = SinglePassScanner::ScanMethod::Scalar;
+        }
 
         constexpr static File::CharType section_memory[] = STR("Memory");
         REGISTER_INT64_SETTING(Memory.MaxMemoryUsageDuringAssetLoading, section_memory, MaxMemoryUsageDuringAssetLoading)
@@ -7,10 +7,15 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cwctype>
 #include <format>
 #include <fstream>
+#include <future>
 #include <limits>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <fmt/chrono.h>
 #include <Profiler/Profiler.hpp>
@@ -26,6 +31,7 @@
 #include <Helpers/Time.hpp>
 #include <IniParser/Ini.hpp>
 #include <LuaLibrary.hpp>
+#include <LuaMadeSimple/BytecodeCache.hpp>
 #include <LuaType/LuaCustomProperty.hpp>
 #include <LuaType/LuaUObject.hpp>
 #include <Mod/CppMod.hpp>
@@ -206,9 +212,28 @@ namespace RC
 
             m_debugging_gui.set_gfx_backend(settings_manager.Debug.GraphicsAPI);
 
+            if (settings_manager.Lua.CacheBytecodeOnDisk)
+            {
+                // The Luau compiler is built into UE4SS, so the build identifies the compiler version as well
+                LuaMadeSimple::BytecodeCache::set_directory(m_root_directory / "cache" / "luau",
+                                                            fmt::format("{}.{}.{}.{}.{}-{}",
+                                                                        UE4SS_LIB_VERSION_MAJOR,
+                                                                        UE4SS_LIB_VERSION_MINOR,
+                                                                        UE4SS_LIB_VERSION_HOTFIX,
+                                                                        UE4SS_LIB_VERSION_PRERELEASE,
+                                                                        UE4SS_LIB_VERSION_BETA,
+                                                                        UE4SS_LIB_BUILD_GITSHA));
+                LuaMadeSimple::BytecodeCache::prune(std::chrono::days{30});
+            }
+            LuauCompat::s_native_codegen_allowed = settings_manager.Lua.EnableNativeCodeGen;
+
             // Setup the log file
             auto& file_device = Output::set_default_devices<Output::NewFileDevice>();
             file_device.set_file_name_and_path(ensure_str((m_log_directory / m_log_file_name)));
+            if (settings_manager.Debug.AsyncLogFileFlushIntervalMs > 0)
+            {
+                file_device.enable_async_writes(std::chrono::milliseconds(settings_manager.Debug.AsyncLogFileFlushIntervalMs));
+            }
 
             if (const auto ue4ss_mods_paths_var_raw = std::getenv("UE4SS_MODS_PATHS"); ue4ss_mods_paths_var_raw)
             {
@@ -371,7 +396,11 @@ namespace RC
     UE4SSProgram::~UE4SSProgram()
     {
         // Shut down the event loop
-        m_processing_events = false;
+        {
+            std::lock_guard<std::mutex> guard(m_event_queue_mutex);
+            m_processing_events = false;
+        }
+        m_event_queue_cv.notify_all();
 
         // It's possible that main() will destroy the default devices (they are static)
         // However it's also possible that this program object is constructed in a context where main() is not gonna immediately exit
@@ -577,6 +606,13 @@ namespace RC
         config.SecondsToScanBeforeGivingUp = settings_manager.General.SecondsToScanBeforeGivingUp;
         config.bUseUObjectArrayCache = settings_manager.General.UseUObjectArrayCache;
 
+        // Results of every scan done through the SinglePassScanner are cached per module build
+        // Cached matches are re-verified before use so this doesn't need to be invalidated when ue4ss.dll changes
+        if (settings_manager.General.UseCache)
+        {
+            SinglePassScanner::m_scan_result_cache_directory = config.CachePath;
+        }
+
         // Retrieve from the config file the number of threads to be used for aob scanning
         {
             // The config system only directly supports signed 64-bit integers
@@ -603,6 +639,8 @@ namespace RC
             }
         }
 
+        SinglePassScanner::m_scan_method = settings_manager.Threads.SigScannerScanMethod;
+
         // Version override from ini file
         {
             int64_t major_version = settings_manager.EngineVersionOverride.MajorVersion;
@@ -1044,6 +1082,8 @@ namespace RC
 
             // Set default ExecuteInGameThread method from settings
             LuaMod::m_default_game_thread_method = settings_manager.General.DefaultExecuteInGameThreadMethod;
+            LuaMod::m_delayed_game_thread_actions.set_time_budget(
+                    std::chrono::microseconds(static_cast<int64_t>(settings_manager.General.DelayedActionTimeBudgetMs * 1000.0f)));
 
             install_lua_mods();
             LuaMod::on_program_start();
@@ -1066,11 +1106,27 @@ namespace RC
 
         on_program_start();
 
+        // Input is polled & C++ mods expect 'on_update' to keep being called, so those still run every tick
+        // Queued events wake the loop up straight away instead of waiting for the next tick
+        static constexpr auto tick_interval = std::chrono::milliseconds(5);
+        auto next_tick = std::chrono::steady_clock::now();
+
         Output::send(STR("Event loop start\n"));
         for (m_processing_events = true; m_processing_events;)
         {
-            if (m_pause_events_processing || UE4SSProgram::unreal_is_shutting_down)
+            if (UE4SSProgram::unreal_is_shutting_down)
+            {
+                // Nothing is processed anymore, so there's nothing to wake up for until the program is destroyed
+                std::unique_lock<std::mutex> lock(m_event_queue_mutex);
+                m_event_queue_cv.wait(lock, [&] {
+                    return !m_processing_events;
+                });
+                continue;
+            }
+
+            if (m_pause_events_processing)
             {
+                std::this_thread::sleep_for(tick_interval);
                 continue;
             }
 
@@ -1116,23 +1172,32 @@ namespace RC
                 }
             }
             //*/
+
+            if (std::chrono::steady_clock::now() >= next_tick)
+            {
 #ifdef HAS_INPUT
-            m_input_handler.process_event();
+                m_input_handler.process_event();
 #endif
-            {
-                ProfilerScopeNamed("mod update processing");
-
-                for (auto& mod : m_mods)
                 {
-                    if (mod->is_started())
+                    ProfilerScopeNamed("mod update processing");
+
+                    for (auto& mod : m_mods)
                     {
-                        mod->fire_update();
+                        if (mod->is_started())
+                        {
+                            mod->fire_update();
+                        }
                     }
                 }
+
+                next_tick = std::chrono::steady_clock::now() + tick_interval;
+                ProfilerFrameMark();
             }
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(5));
-            ProfilerFrameMark();
+            std::unique_lock<std::mutex> lock(m_event_queue_mutex);
+            m_event_queue_cv.wait_until(lock, next_tick, [&] {
+                return !m_queued_events.empty() || !m_processing_events;
+            });
         }
         Output::send(STR("Event loop end\n"));
     }
@@ -1330,11 +1395,63 @@ namespace RC
         }
     }
 
+    // Compiles the scripts of all mods that are about to be started on a thread pool
+    // Starting a mod needs the game thread and has to happen in load order, but compiling its scripts needs neither
+    static auto precompile_lua_mods(const std::vector<Mod*>& mods) -> void
+    {
+        ProfilerScope();
+
+        if (mods.empty())
+        {
+            return;
+        }
+
+        double duration{};
+        {
+            ScopedTimer timer{&duration};
+            const auto num_threads = std::min(std::clamp<size_t>(std::thread::hardware_concurrency(), 2, 17) - 1, mods.size());
+            std::atomic<size_t> next_mod{};
+            std::vector<std::future<void>> threads{};
+            for (size_t thread_index = 0; thread_index < num_threads; ++thread_index)
+            {
+                threads.emplace_back(std::async(std::launch::async, [&] {
+                    for (size_t mod_index = next_mod++; mod_index < mods.size(); mod_index = next_mod++)
+                    {
+                        static_cast<LuaMod*>(mods[mod_index])->precompile_scripts();
+                    }
+                }));
+            }
+            for (auto& thread : threads)
+            {
+                thread.get();
+            }
+        }
+        Output::send(STR("Compiled scripts for {} Lua mods in {:.2f} ms\n"), mods.size(), duration * 1000.0);
+    }
+
     template <typename ModType>
     auto start_mods() -> std::string
     {
         ProfilerScope();
 
+        // Mods are collected first and started once every mods.txt & enabled.txt has been processed, in the same order
+        std::vector<Mod*> mods_to_start{};
+        const auto is_started_or_queued = [&](Mod* mod) {
+            return mod->is_started() || std::ranges::find(mods_to_start, mod) != mods_to_start.end();
+        };
+        const auto start_queued_mods = [&](std::string error_message) -> std::string {
+            if constexpr (std::is_same_v<ModType, LuaMod>)
+            {
+                precompile_lua_mods(mods_to_start);
+            }
+            for (auto mod : mods_to_start)
+            {
+                Output::send(STR("Starting {} mod '{}'\n"), std::is_same_v<ModType, LuaMod> ? STR("Lua") : STR("C++"), mod->get_name().data());
+                mod->start_mod();
+            }
+            return error_message;
+        };
+
         // Determine which mods.txt file(s) to parse
         std::vector<std::filesystem::path> mods_txt_files_to_parse;
 
@@ -1424,15 +1541,14 @@ namespace RC
                     StringType mod_enabled = explode_by_occurrence(current_line, STR(':'), ExplodeType::FromEnd);
 
                     auto mod = UE4SSProgram::find_mod_by_name<ModType>(mod_name, UE4SSProgram::IsInstalled::Yes);
-                    if (!mod || !dynamic_cast<ModType*>(mod) || mod->is_started())
+                    if (!mod || !dynamic_cast<ModType*>(mod) || is_started_or_queued(mod))
                     {
                         continue;
                     }
 
                     if (!mod_enabled.empty() && mod_enabled[0] == STR('1'))
                     {
-                        Output::send(STR("Starting {} mod '{}'\n"), std::is_same_v<ModType, LuaMod> ? STR("Lua") : STR("C++"), mod->get_name().data());
-                        mod->start_mod();
+                        mods_to_start.emplace_back(mod);
                     }
                     else
                     {
@@ -1462,7 +1578,7 @@ namespace RC
                 }
                 if (ec.value() != 0)
                 {
-                    return fmt::format("is_directory ran into error {}", ec.value());
+                    return start_queued_mods(fmt::format("is_directory ran into error {}", ec.value()));
                 }
 
                 if (!std::filesystem::exists(mod_directory.path() / "enabled.txt", ec))
@@ -1471,7 +1587,7 @@ namespace RC
                 }
                 if (ec.value() != 0)
                 {
-                    return fmt::format("exists ran into error {}", ec.value());
+                    return start_queued_mods(fmt::format("exists ran into error {}", ec.value()));
                 }
 
                 auto mod = UE4SSProgram::find_mod_by_name<ModType>(ensure_str(mod_directory.path().stem()), UE4SSProgram::IsInstalled::Yes);
@@ -1485,17 +1601,17 @@ namespace RC
                     continue;
                 }
 
-                if (mod->is_started())
+                if (is_started_or_queued(mod))
                 {
                     continue;
                 }
 
                 Output::send(STR("Mod '{}' has enabled.txt, starting mod.\n"), mod->get_name().data());
-                mod->start_mod();
+                mods_to_start.emplace_back(mod);
             }
         }
 
-        return {};
+        return start_queued_mods({});
     }
 
     auto UE4SSProgram::start_lua_mods() -> void
@@ -1651,7 +1767,9 @@ namespace RC
         LuaType::LuaCustomProperty::StaticStorage::property_list.clear();
 
         // Reset the Lua callbacks for the global Lua function 'NotifyOnNewObject'
-        LuaMod::m_static_construct_object_lua_callbacks.clear();
+        LuaMod::modify_static_construct_object_callbacks([](LuaMod::StaticConstructObjectCallbacks& callbacks) {
+            callbacks.clear();
+        });
 
         // Start processing events again as everything is now properly setup
         // Do this before mods are started or else you won't be able to use the hot-reload key bind if there's an error from Lua
@@ -2178,8 +2296,11 @@ namespace RC
         {
             return;
         }
-        std::lock_guard<std::mutex> guard(m_event_queue_mutex);
-        m_queued_events.emplace_back(std::move(callable));
+        {
+            std::lock_guard<std::mutex> guard(m_event_queue_mutex);
+            m_queued_events.emplace_back(std::move(callable));
+        }
+        m_event_queue_cv.notify_one();
     }
 
     auto UE4SSProgram::queue_event(LegacyEventCallable callable, void* data) -> void
@@ -2289,6 +2410,18 @@ namespace RC
         return ensure_str(m_object_dumper_output_directory);
     }
 
+    // Properties (below 4.25) & non-delegate functions are dumped as part of the struct that owns them instead of on their own
+    static auto is_dumped_as_object(UObject* object, bool is_below_425) -> bool
+    {
+        static auto delegate_function_class = UObjectGlobals::StaticFindObject<UClass*>(nullptr, nullptr, STR("/Script/CoreUObject.DelegateFunction"));
+        static auto linker_placeholder_function_class =
+                UObjectGlobals::StaticFindObject<UClass*>(nullptr, nullptr, STR("/Script/CoreUObject.LinkerPlaceholderFunction"));
+
+        bool is_property = is_below_425 && Unreal::TypeChecker::is_property(object) &&
+                           !object->HasAnyFlags(static_cast<EObjectFlags>(EObjectFlags::RF_DefaultSubObject | EObjectFlags::RF_ArchetypeObject));
+        return !is_property && (!object->IsA<UFunction>() || object->IsA(delegate_function_class) || object->IsA(linker_placeholder_function_class));
+    }
+
     auto UE4SSProgram::dump_uobject(UObject* object,
                                     std::unordered_set<FField*>* in_dumped_fields,
                                     StringType& out_line,
@@ -2311,13 +2444,7 @@ namespace RC
 
         UObject* typed_obj = static_cast<UObject*>(object);
 
-        static auto delegate_function_class = UObjectGlobals::StaticFindObject<UClass*>(nullptr, nullptr, STR("/Script/CoreUObject.DelegateFunction"));
-        static auto linker_placeholder_function_class =
-                UObjectGlobals::StaticFindObject<UClass*>(nullptr, nullptr, STR("/Script/CoreUObject.LinkerPlaceholderFunction"));
-
-        bool is_property = is_below_425 && Unreal::TypeChecker::is_property(typed_obj) &&
-                           !typed_obj->HasAnyFlags(static_cast<EObjectFlags>(EObjectFlags::RF_DefaultSubObject | EObjectFlags::RF_ArchetypeObject));
-        if (!is_property && (!typed_obj->IsA<UFunction>() || typed_obj->IsA(delegate_function_class) || typed_obj->IsA(linker_placeholder_function_class)))
+        if (is_dumped_as_object(typed_obj, is_below_425))
         {
             if (in_dumped_functions && typed_obj->IsA<UFunction>())
             {
@@ -2391,6 +2518,223 @@ namespace RC
         }
     }
 
+    // Dumps GUObjectArray in batches of objects that are formatted by a pool of threads and written to 'dump_file' in order by the calling thread
+    // Only a few batches are ever in memory at the same time, and the output is identical to dumping every object in order on one thread
+    static auto dump_all_objects_streamed(File::Handle& dump_file, bool is_below_425) -> void
+    {
+        constexpr int32_t objects_per_batch = 1024;
+
+        const auto num_objects = static_cast<int32_t>(UObjectArray::GetNumElements());
+        const auto num_batches = static_cast<size_t>((num_objects + objects_per_batch - 1) / objects_per_batch);
+        // One core is left for the game thread
+        const auto num_threads = std::clamp<size_t>(std::thread::hardware_concurrency(), 2, 17) - 1;
+        const auto max_batches_in_flight = num_threads * 4;
+
+        const auto get_object = [](int32_t object_index) -> UObject* {
+            auto object_item = static_cast<FUObjectItem*>(Container::UnrealVC->UObjectArray_index_to_object(object_index));
+            return object_item ? object_item->GetUObject() : nullptr;
+        };
+
+        const auto for_each_batch = [&](const auto& callable) {
+            std::atomic<size_t> next_batch{};
+            std::vector<std::future<void>> threads{};
+            for (size_t thread_index = 0; thread_index < num_threads; ++thread_index)
+            {
+                threads.emplace_back(std::async(std::launch::async, [&] {
+                    for (size_t batch = next_batch++; batch < num_batches; batch = next_batch++)
+                    {
+                        callable(batch);
+                    }
+                }));
+            }
+            return threads;
+        };
+
+        // Some delegate functions belong to a class, and are dumped as part of the class.
+        // Others are not, and must be dumped as part of GUObjectArray.
+        // A function must only be dumped by the first object in GUObjectArray that would dump it, so that's worked out before anything is dumped.
+        // Fields don't need the same treatment because they're only ever dumped by the struct that owns them.
+        std::unordered_map<UFunction*, int32_t> function_owners{};
+        {
+            std::mutex function_owners_mutex{};
+            auto claim_threads = for_each_batch([&](size_t batch) {
+                std::unordered_map<UFunction*, int32_t> batch_function_owners{};
+                const auto claim = [&](UFunction* function, int32_t object_index) {
+                    batch_function_owners.try_emplace(function, object_index);
+                };
+
+                const auto batch_end = std::min(static_cast<int32_t>((batch + 1) * objects_per_batch), num_objects);
+                for (auto object_index = static_cast<int32_t>(batch * objects_per_batch); object_index < batch_end; ++object_index)
+                {
+                    auto object = get_object(object_index);
+                    if (!object || !is_dumped_as_object(object, is_below_425))
+                    {
+                        continue;
+                    }
+                    if (object->IsA<UFunction>())
+                    {
+                        claim(static_cast<UFunction*>(object), object_index);
+                    }
+                    if (object->IsA<UStruct>())
+                    {
+                        for (UFunction* function : TFieldRange<UFunction>(static_cast<UStruct*>(object), Unreal::EFieldIterationFlags::None))
+                        {
+                            claim(function, object_index);
+                        }
+                    }
+                }
+
+                std::lock_guard<std::mutex> lock(function_owners_mutex);
+                for (const auto& [function, object_index] : batch_function_owners)
+                {
+                    auto [it, inserted] = function_owners.try_emplace(function, object_index);
+                    if (!inserted && object_index < it->second)
+                    {
+                        it->second = object_index;
+                    }
+                }
+            });
+            for (auto& thread : claim_threads)
+            {
+                thread.get();
+            }
+        }
+
+        // Batches are written in order, a thread that gets too far ahead waits for the writer to catch up
+        struct BatchSlot
+        {
+            StringType text{};
+            size_t batch{};
+            bool is_ready{};
+        };
+        std::vector<BatchSlot> slots(max_batches_in_flight);
+        std::mutex slots_mutex{};
+        std::condition_variable slots_cv{};
+        size_t num_batches_written{};
+        bool is_aborted{};
+
+        auto dump_threads = for_each_batch([&](size_t batch) {
+            {
+                std::unique_lock<std::mutex> lock(slots_mutex);
+                slots_cv.wait(lock, [&] {
+                    return is_aborted || batch < num_batches_written + max_batches_in_flight;
+                });
+                if (is_aborted)
+                {
+                    return;
+                }
+            }
+
+            // The slot isn't touched by anyone else until it's marked as ready
+            auto& slot = slots[batch % max_batches_in_flight];
+            slot.text.clear();
+            try
+            {
+                std::unordered_set<FField*> dumped_fields{};
+                std::unordered_set<UFunction*> dumped_functions{};
+
+                const auto batch_end = std::min(static_cast<int32_t>((batch + 1) * objects_per_batch), num_objects);
+                for (auto object_index = static_cast<int32_t>(batch * objects_per_batch); object_index < batch_end; ++object_index)
+                {
+                    auto object = get_object(object_index);
+                    if (!object)
+                    {
+                        continue;
+                    }
+
+                    // Functions claimed by an earlier object are marked as already dumped
+                    dumped_functions.clear();
+                    if (object->IsA<UFunction>())
+                    {
+                        if (auto it = function_owners.find(static_cast<UFunction*>(object)); it != function_owners.end() && it->second != object_index)
+                        {
+                            dumped_functions.emplace(it->first);
+                        }
+                    }
+                    if (object->IsA<UStruct>())
+                    {
+                        for (UFunction* function : TFieldRange<UFunction>(static_cast<UStruct*>(object), Unreal::EFieldIterationFlags::None))
+                        {
+                            if (auto it = function_owners.find(function); it != function_owners.end() && it->second != object_index)
+                            {
+                                dumped_functions.emplace(function);
+                            }
+                        }
+                    }
+
+                    UE4SSProgram::dump_uobject(object, &dumped_fields, slot.text, is_below_425, &dumped_functions);
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(slots_mutex);
+                is_aborted = true;
+                slots_cv.notify_all();
+                throw;
+            }
+
+            std::lock_guard<std::mutex> lock(slots_mutex);
+            slot.batch = batch;
+            slot.is_ready = true;
+            slots_cv.notify_all();
+        });
+
+        try
+        {
+            for (size_t batch = 0; batch < num_batches; ++batch)
+            {
+                auto& slot = slots[batch % max_batches_in_flight];
+                {
+                    std::unique_lock<std::mutex> lock(slots_mutex);
+                    slots_cv.wait(lock, [&] {
+                        return is_aborted || (slot.is_ready && slot.batch == batch);
+                    });
+                    if (is_aborted)
+                    {
+                        break;
+                    }
+                }
+
+                if (!slot.text.empty())
+                {
+                    dump_file.write_string_to_file(slot.text);
+                }
+
+                std::lock_guard<std::mutex> lock(slots_mutex);
+                slot.is_ready = false;
+                ++num_batches_written;
+                slots_cv.notify_all();
+            }
+        }
+        catch (...)
+        {
+            // The dump threads are waiting for the writer, they must be released & joined before the error can leave this function
+            {
+                std::lock_guard<std::mutex> lock(slots_mutex);
+                is_aborted = true;
+                slots_cv.notify_all();
+            }
+            for (auto& thread : dump_threads)
+            {
+                try
+                {
+                    thread.get();
+                }
+                catch (...)
+                {
+                    // The writer's error is the one that's reported
+                }
+            }
+            throw;
+        }
+
+        // Rethrows anything that was thrown while dumping
+        for (auto& thread : dump_threads)
+        {
+            thread.get();
+        }
+    }
+
     auto UE4SSProgram::dump_all_objects_and_properties(const File::StringType& output_path_and_file_name) -> void
     {
         /*
@@ -2418,53 +2762,16 @@ namespace RC
         {
             ScopedTimer dumper_timer{&dumper_duration};
 
-            std::unordered_set<FField*> dumped_fields;
-            // There will be tons of dumped fields so lets just reserve tons in order to speed things up a bit
-            dumped_fields.reserve(100000);
-
-            // Some delegate functions belong to a class, and are dumped as part of the class.
-            // Others are not, and must be dumped as part of GUObjectArray.
-            // Both are part of GUObjectArray.
-            // We must maintain a list of already dumped functions to avoid dumping the same function multiple times.
-            // We can't just use GUObjectArray even though they all exist in there because that would destroy the order in which objects get dumped.
-            std::unordered_set<UFunction*> dumped_functions;
-            dumped_fields.reserve(10000);
-
             bool is_below_425 = Unreal::Version::IsBelow(4, 25);
 
+            auto dump_file = File::open(output_path_and_file_name, File::OpenFor::Appending, File::OverwriteExistingFile::Yes, File::CreateIfNonExistent::Yes);
+
             // The final outputted string shouldn't need be reformatted just to put a new line at the end
             // Instead the object/property implementations should add a new line in the last format that they do
-            //
-            // Optimizations done:
-            // 1. The entire code-base has been changed to use 'wchar_t' instead of 'char'.
-            // The effect of this is that there is no need to ever convert between types.
-            // There's also no thinking about which type should be used since 'wchar_t' is now the standard for UE4SS.
-            // The downside with wchar_t is that all files that get output to will be doubled in size.
-
-            using ObjectDumperOutputDevice = Output::NewFileDevice;
-            Output::Targets<ObjectDumperOutputDevice> scoped_dumper_out;
-            auto& file_device = scoped_dumper_out.get_device<ObjectDumperOutputDevice>();
-            file_device.set_file_name_and_path(output_path_and_file_name);
-            file_device.set_formatter([](File::StringViewType string) -> File::StringType {
-                return File::StringType{string};
-            });
-
-            // Make string & reserve massive amounts of space to hopefully not reach the end of the string and require more
-            // dynamic allocations
-            StringType out_line;
-            out_line.reserve(200000000);
-
             Output::send(STR("Dumping all objects & properties in GUObjectArray\n"));
-            UObjectGlobals::ForEachUObject([&](void* object, [[maybe_unused]] int32_t chunk_index, [[maybe_unused]] int32_t object_index) {
-                dump_uobject(static_cast<UObject*>(object), &dumped_fields, out_line, is_below_425, &dumped_functions);
-                return LoopAction::Continue;
-            });
-
-            // Save to file
-            scoped_dumper_out.send(out_line);
+            dump_all_objects_streamed(dump_file, is_below_425);
+            dump_file.close();
 
-            // Reset the dumped_fields set, otherwise no fields will be dumped in subsequent dumps
-            dumped_fields.clear();
             Output::send(STR("Done iterating GUObjectArray\n"));
         }
 
@@ -2,12 +2,15 @@
 
 // writer.h is missing includes and I'd like to keep it unchanged so I'll include the missing files here instead.
 #include <Unreal/Common.hpp>
+#include <cstring>
 #include <sstream>
 #include <string>
 
 #include <DynamicOutput/DynamicOutput.hpp>
 #include <USMapGenerator/Generator.hpp>
 #include <USMapGenerator/writer.h>
+#include <USMapWriter/BufferWriter.hpp>
+#include <USMapWriter/UsmapFile.hpp>
 #include <Unreal/NameTypes.hpp>
 #include <Unreal/CoreUObject/UObject/UnrealType.hpp>
 #include <Unreal/Property/FEnumProperty.hpp>
@@ -24,18 +27,6 @@ namespace RC::OutTheShade
 {
     using namespace ::RC::Unreal;
 
-    enum class EUsmapVersion : uint8_t
-    {
-        Initial = 0,
-        PackageVersioning = 1,
-        LongFName = 2,
-        LargeEnums = 3,
-        ExplicitEnumValues = 4,
-
-        Latest = ExplicitEnumValues,
-        LatestPlusOne
-    };
-
     enum class EPropertyType : uint8_t
     {
         ByteProperty,
@@ -226,7 +217,7 @@ namespace RC::OutTheShade
         Output::send(STR("Mappings Generator by OutTheShade\nAttempting to dump mappings...\nPort of https://github.com/OutTheShade/UnrealMappingsDumper "
                          "Commit SHA 4da8c66\n"));
 
-        StreamWriter Buffer;
+        BufferWriter Buffer;
         std::unordered_map<FName, int> NameMap;
         std::unordered_map<UObject*, FName> ModulePathsMap;
 
@@ -439,7 +430,7 @@ namespace RC::OutTheShade
         Buffer.Write<uint32_t>(0x48545050); // ext id
         Buffer.Write<uint32_t>(0);          // size; unknown for now
 
-        std::streampos extStartPos = Buffer.GetBuffer().tellp();
+        size_t extStartPos = Buffer.Tell();
         Buffer.Write<uint8_t>(0); // PPTH version; 0
         Buffer.Write<uint32_t>(static_cast<uint32_t>(Enums.size()));
         for (auto Enum : Enums)
@@ -451,18 +442,15 @@ namespace RC::OutTheShade
         {
             Buffer.Write(NameMap[ModulePathsMap[Struct]]);
         }
-        std::streampos extEndPos = Buffer.GetBuffer().tellp();
+        size_t extEndPos = Buffer.Tell();
 
-        Buffer.GetBuffer().seekp(extStartPos);
-        Buffer.GetBuffer().seekp(-(int32)sizeof(uint32), std::ios_base::cur);
-        Buffer.Write<uint32_t>(extEndPos - extStartPos);
-        Buffer.GetBuffer().seekp(extEndPos);
+        Buffer.WriteAt<uint32_t>(extStartPos - sizeof(uint32_t), static_cast<uint32_t>(extEndPos - extStartPos));
 
         // extension 2: EATR (extended attributes)
         Buffer.Write<uint32_t>(0x52544145); // ext id
         Buffer.Write<uint32_t>(0);          // size; unknown for now
 
-        extStartPos = Buffer.GetBuffer().tellp();
+        extStartPos = Buffer.Tell();
         Buffer.Write<uint8_t>(0); // EATR version; 0
         Buffer.Write<uint32_t>(static_cast<uint32_t>(Enums.size()));
         for (auto Enum : Enums)
@@ -495,21 +483,27 @@ namespace RC::OutTheShade
             for (uint64_t propFlag : propFlags)
                 Buffer.Write<uint64_t>(propFlag);
         }
-        extEndPos = Buffer.GetBuffer().tellp();
+        extEndPos = Buffer.Tell();
 
-        Buffer.GetBuffer().seekp(extStartPos);
-        Buffer.GetBuffer().seekp(-(int32)sizeof(uint32), std::ios_base::cur);
-        Buffer.Write<uint32_t>(extEndPos - extStartPos);
-        Buffer.GetBuffer().seekp(extEndPos);
+        Buffer.WriteAt<uint32_t>(extStartPos - sizeof(uint32_t), static_cast<uint32_t>(extEndPos - extStartPos));
 
         // ENVP extension removed - enum values are now written explicitly in the main format (version 4)
 
         // end of extensions //
 
+        if (const auto& UnknownCompressionMethod = UE4SSProgram::settings_manager.UsmapGenerator.UnknownCompressionMethod; !UnknownCompressionMethod.empty())
+        {
+            Output::send<LogLevel::Error>(STR("Unknown CompressionMethod '{}' in the [UsmapGenerator] section of UE4SS-settings.ini, valid values are None, "
+                                              "Brotli and ZStandard. Writing the mappings uncompressed.\n"),
+                                          UnknownCompressionMethod);
+        }
+
+        const auto CompressionMethod = UE4SSProgram::settings_manager.UsmapGenerator.CompressionMethod;
         std::vector<uint8_t> UsmapData;
-        std::string UncompressedStream = Buffer.GetBuffer().str();
-        UsmapData.resize(UncompressedStream.size());
-        memcpy(UsmapData.data(), UncompressedStream.data(), UsmapData.size());
+        if (WriteUsmapFile(CompressionMethod, Buffer.GetBuffer(), UsmapData) != CompressionMethod)
+        {
+            Output::send<LogLevel::Warning>(STR("Failed to compress mappings, writing them uncompressed instead\n"));
+        }
 
         // Build filename: GameName-EngineVersion-UE4SSCommitSHA.usmap
         FString game_name_fstr = UKismetSystemLibrary::GetGameName();
@@ -537,15 +531,7 @@ namespace RC::OutTheShade
         auto filename = to_string(UE4SSProgram::get_program().get_working_directory()) + "//" + usmap_filename;
         auto FileOutput = FileWriter(filename.c_str());
 
-        FileOutput.Write<uint16_t>(0x30C4); // magic
-        FileOutput.Write<uint8_t>(static_cast<uint8_t>(EUsmapVersion::Latest)); // version
-        FileOutput.Write<int32_t>(0);       // bHasVersionInfo (false, no UE4/UE5 version info)
-        FileOutput.Write<uint8_t>(0);       // compression
-        // Warning: Converting size_t (uint64) to int.
-        FileOutput.Write<uint32_t>(static_cast<uint32_t>(UsmapData.size())); // compressed size
-        FileOutput.Write<uint32_t>(Buffer.Size());                           // decompressed size
-
-        FileOutput.Write(UsmapData.data(), UsmapData.size());
+        FileOutput.Write((void*)UsmapData.data(), UsmapData.size());
 
         Output::send(STR("Mappings Generation Completed Successfully!\n"));
         Output::send(STR("Output file: {}\n"), to_wstring(usmap_filename));
@@ -221,6 +221,151 @@ test("string.sub", string.sub("hello", 1, 3) == "hel")
 test("string.find", string.find("hello world", "world") == 7)
 test("string.gsub", select(1, string.gsub("hello", "l", "L")) == "heLLo")
 
+-- ============================================
+-- TEST 11: Read-only constant tables
+-- ============================================
+print(string.format("%s\n%s Test Group: Read-only Constant Tables\n", MOD_NAME, MOD_NAME))
+
+local readonly_tables = {
+    Key = Key,
+    ModifierKey = ModifierKey,
+    EObjectFlags = EObjectFlags,
+    EInternalObjectFlags = EInternalObjectFlags,
+    EFindName = EFindName,
+    PropertyTypes = PropertyTypes,
+}
+for name, readonly_table in readonly_tables do
+    test(name .. " is read-only", table.isfrozen(readonly_table))
+    test(name .. " rejects new entries", not pcall(function() readonly_table.LuauTestModEntry = 1 end))
+end
+test("Key values are still readable", type(Key.L) == "number")
+test("EObjectFlags values are still readable", EObjectFlags.RF_ClassDefaultObject ~= nil)
+
+-- Mods that need extra entries copy the table first
+local extended_keys = table.clone(Key)
+extended_keys.LuauTestModEntry = 1
+test("copied Key table is writable", extended_keys.LuauTestModEntry == 1 and extended_keys.L == Key.L)
+
+-- ============================================
+-- TEST 12: NotifyOnNewObject
+-- ============================================
+print(string.format("%s\n%s Test Group: NotifyOnNewObject\n", MOD_NAME, MOD_NAME))
+
+test("NotifyOnNewObject exists", type(NotifyOnNewObject) == "function")
+
+local notify_class_name = "/Script/Engine.GameplayStatics"
+local notify_class = StaticFindObject(notify_class_name)
+if engine and notify_class and notify_class:IsValid() then
+    local outer_calls = 0
+    local inner_calls = 0
+
+    -- Registers a callback for the same class from inside a callback, then unregisters itself by returning true
+    -- The callback registered from inside only runs for objects constructed after the one that registered it
+    NotifyOnNewObject(notify_class_name, function(constructed_object)
+        outer_calls += 1
+        NotifyOnNewObject(notify_class_name, function()
+            inner_calls += 1
+            return true
+        end)
+        return true
+    end)
+
+    local first_ok = pcall(StaticConstructObject, notify_class, engine)
+    test("NotifyOnNewObject callback can register another callback", first_ok and outer_calls == 1 and inner_calls == 0,
+        string.format("outer=%d inner=%d", outer_calls, inner_calls))
+
+    local second_ok = pcall(StaticConstructObject, notify_class, engine)
+    test("NotifyOnNewObject callback returning true is unregistered", second_ok and outer_calls == 1 and inner_calls == 1,
+        string.format("outer=%d inner=%d", outer_calls, inner_calls))
+
+    pcall(StaticConstructObject, notify_class, engine)
+    test("NotifyOnNewObject nested callback is unregistered too", inner_calls == 1, string.format("inner=%d", inner_calls))
+end
+
+-- ============================================
+-- TEST 13: Actor batch hooks
+-- ============================================
+print(string.format("%s\n%s Test Group: Actor Batch Hooks\n", MOD_NAME, MOD_NAME))
+
+test("UnregisterBeginPlayBatchHook exists", type(UnregisterBeginPlayBatchHook) == "function")
+test("UnregisterEndPlayBatchHook exists", type(UnregisterEndPlayBatchHook) == "function")
+test("UnregisterBeginPlayBatchHook rejects a non-integer id", not pcall(UnregisterBeginPlayBatchHook, "not an id"))
+
+-- Registering needs the EngineTick hook, which isn't found in every game
+local batch_hooks = {
+    BeginPlay = { RegisterBeginPlayBatchHook, UnregisterBeginPlayBatchHook },
+    EndPlay = { RegisterEndPlayBatchHook, UnregisterEndPlayBatchHook },
+}
+for name, functions in batch_hooks do
+    local register, unregister = functions[1], functions[2]
+    local register_ok, callback_id = pcall(register, "/Script/Engine.Actor", function() end)
+    if register_ok then
+        test(name .. " batch hook returns an integer id", type(callback_id) == "number" and callback_id == math.floor(callback_id))
+        test(name .. " batch hook can be unregistered", pcall(unregister, callback_id))
+        test(name .. " batch hook can be unregistered twice", pcall(unregister, callback_id))
+    else
+        print(string.format("%s SKIP: %s batch hook - %s\n", MOD_NAME, name, tostring(callback_id)))
+    end
+end
+
+-- ============================================
+-- TEST 14: TArray bulk conversion
+-- ============================================
+print(string.format("%s\n%s Test Group: TArray Bulk Conversion\n", MOD_NAME, MOD_NAME))
+
+local world = FindFirstOf("World")
+if world and world:IsValid() then
+    -- TArray<ULevel*>
+    local levels = world.Levels
+    if levels and levels:IsValid() then
+        local level_table = levels:ToTable()
+        test("ToTable returns every element", #level_table == levels:GetArrayNum())
+        test("ToTable elements are objects", level_table[1] == nil or level_table[1]:IsValid())
+        test("ToBuffer rejects arrays of objects", not pcall(function() return levels:ToBuffer() end))
+        test("CopyFromBuffer rejects arrays of objects", not pcall(function() levels:CopyFromBuffer(buffer.create(0)) end))
+        test("CopyFromBuffer leaves rejected arrays alone", levels:GetArrayNum() == #level_table)
+    end
+end
+
+if engine then
+    -- TArray<FString>
+    local server_actors = engine.ServerActors
+    if server_actors and server_actors:IsValid() then
+        test("ToBuffer rejects arrays that own memory", not pcall(function() return server_actors:ToBuffer() end))
+        test("ToTable converts arrays that own memory", #server_actors:ToTable() == server_actors:GetArrayNum())
+    end
+end
+
+-- ============================================
+-- TEST 15: Filtered object searches
+-- ============================================
+print(string.format("%s\n%s Test Group: Filtered Object Searches\n", MOD_NAME, MOD_NAME))
+
+test("IterateAllOf exists", type(IterateAllOf) == "function")
+test("ForEachOf exists", type(ForEachOf) == "function")
+
+-- Short class names are looked up the same way with and without filters
+local unfiltered_engines = FindAllOf("Engine") or {}
+local filtered_engines = FindAllOf("Engine", {}) or {}
+test("FindAllOf finds the same objects with and without filters", #unfiltered_engines == #filtered_engines,
+    string.format("unfiltered=%d filtered=%d", #unfiltered_engines, #filtered_engines))
+
+local iterated_engines = 0
+for iterated_engine in IterateAllOf("Engine") do
+    iterated_engines += 1
+end
+test("IterateAllOf finds the same objects as FindAllOf", iterated_engines == #unfiltered_engines,
+    string.format("iterated=%d found=%d", iterated_engines, #unfiltered_engines))
+
+local limited_actors = FindAllOf("Actor", { Limit = 1 })
+test("FindAllOf Limit filter", limited_actors == nil or #limited_actors == 1)
+
+local undestroyed_engines = FindAllOf("Engine", {
+    BannedFlags = bit32.bor(EObjectFlags.RF_BeginDestroyed, EObjectFlags.RF_FinishDestroyed),
+}) or {}
+test("FindAllOf BannedFlags filter", #undestroyed_engines == #unfiltered_engines)
+test("FindAllOf rejects unknown filters", not pcall(FindAllOf, "Engine", { NotAFilter = 1 }))
+
 -- ============================================
 -- SUMMARY
 -- ============================================
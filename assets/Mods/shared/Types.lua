@@ -207,6 +207,14 @@ PropertyTypes = {}
 ---@class ArrayPropertyInfo
 ---@field Type PropertyTypes[]
 
+---Filters for `FindAllOf`, `ForEachOf` and `IterateAllOf`, checked before any Lua objects are created
+---@class ObjectFilters
+---@field Limit integer? Stop after this many objects have been found, 0 or nil means no limit
+---@field RequiredFlags EObjectFlags? Flags that the object must all have
+---@field BannedFlags EObjectFlags? Flags that the object can't have any of
+---@field Outer UObject? The object must be directly inside this object
+---@field NamePrefix string? The short name of the object must start with this string
+
 ----A table of object flags that can be or'd together by using |.
 ---@enum EObjectFlags
 EObjectFlags = {
@@ -327,6 +335,32 @@ function FindFirstOf(ShortClassName) end
 ---@return UObject[]?
 function FindAllOf(ShortClassName) end
 
+---Find all non-default instances of the supplied class that match the filters
+---@param Class string|UClass Short class name without path info, or the class itself
+---@param Filters ObjectFilters?
+---@return UObject[]?
+function FindAllOf(Class, Filters) end
+
+---Execute the callback function for each non-default instance of the supplied class that matches the filters<br>
+---Return `true` in the callback to stop iterating
+---@param Class string|UClass Short class name without path info, or the class itself
+---@param Callback fun(Object: UObject): boolean?
+function ForEachOf(Class, Callback) end
+
+---Execute the callback function for each non-default instance of the supplied class that matches the filters<br>
+---Return `true` in the callback to stop iterating
+---@param Class string|UClass Short class name without path info, or the class itself
+---@param Filters ObjectFilters
+---@param Callback fun(Object: UObject): boolean?
+function ForEachOf(Class, Filters, Callback) end
+
+---Returns an iterator over the non-default instances of the supplied class that match the filters, for use in `for ... in` loops<br>
+---The instances are all found when this is called, only their Lua objects are created as the loop reaches them
+---@param Class string|UClass Short class name without path info, or the class itself
+---@param Filters ObjectFilters?
+---@return fun(): UObject?
+function IterateAllOf(Class, Filters) end
+
 --- Registers a callback for a key-bind
 --- Callbacks can only be triggered while the game or debug console is on focus
 ---@param Key Key
@@ -641,6 +675,30 @@ function RegisterBeginPlayPreHook(Callback) end
 ---@param Callback fun(Context: RemoteUnrealParam<AActor>)
 function RegisterBeginPlayPostHook(Callback) end
 
+---Registers a callback that will get called once per engine tick with every actor of the class that began play since the previous tick.
+---Inheritance is taken into account, and the class check is done without calling into Lua.
+---Returns an id that can be passed to `UnregisterBeginPlayBatchHook`.
+---@param UClassName string
+---@param Callback fun(Actors: AActor[])
+---@return integer
+function RegisterBeginPlayBatchHook(UClassName, Callback) end
+
+---Unregisters a callback that was registered with `RegisterBeginPlayBatchHook`.
+---@param CallbackId integer
+function UnregisterBeginPlayBatchHook(CallbackId) end
+
+---Registers a callback that will get called once per engine tick with every actor of the class that ended play since the previous tick.
+---Inheritance is taken into account, and the class check is done without calling into Lua.
+---Returns an id that can be passed to `UnregisterEndPlayBatchHook`.
+---@param UClassName string
+---@param Callback fun(Actors: AActor[], EndPlayReasons: integer[])
+---@return integer
+function RegisterEndPlayBatchHook(UClassName, Callback) end
+
+---Unregisters a callback that was registered with `RegisterEndPlayBatchHook`.
+---@param CallbackId integer
+function UnregisterEndPlayBatchHook(CallbackId) end
+
 ---Registers a callback that will get called before UObject::ProcessConsoleExec is called.
 ---The callback params are: UObject Context, string Cmd, table CommandParts, FOutputDevice Ar, UObject Executor
 ---Params (except strings & bools & FOutputDevice) must be retrieved via 'Param:Get()' and set via 'Param:Set()'.
@@ -1320,6 +1378,26 @@ function TArray:Empty() end
 ---@param Callback fun(index: integer, element: RemoteUnrealParam): boolean?
 function TArray:ForEach(Callback) end
 
+---Returns a new table containing every element in the array, converted the same way as indexing the array.<br>
+---Faster than `ForEach` when every element is needed.
+---@return T[]
+function TArray:ToTable() end
+
+---Returns the size in bytes of one element in the array
+---@return integer
+function TArray:GetElementSize() end
+
+---Returns a new buffer containing a copy of the memory of every element in the array.<br>
+---Element `n` starts at byte offset `(n - 1) * GetElementSize()`.<br>
+---Only works for arrays of plain data, such as numbers or structs like `FVector`, not arrays of objects.
+---@return buffer
+function TArray:ToBuffer() end
+
+---Replaces every element in the array with the contents of a buffer laid out like the ones returned by `ToBuffer`.<br>
+---Only works for arrays of plain data, such as numbers or structs like `FVector`, not arrays of objects.
+---@param Buffer buffer
+function TArray:CopyFromBuffer(Buffer) end
+
 ---@class TSet<T>
 local TSet = {}
 
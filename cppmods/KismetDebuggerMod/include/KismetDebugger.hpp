@@ -1,7 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <Unreal/FFrame.hpp>
 #include <Unreal/CoreUObject/UObject/Class.hpp>
@@ -29,6 +33,12 @@ namespace RC::GUI::KismetDebuggerMod
         auto load(std::filesystem::path& path) -> void;
         auto save() -> void;
 
+        // True if there's at least one breakpoint anywhere, cheap enough to check for every expression
+        auto is_armed() const -> bool
+        {
+            return m_is_armed.load(std::memory_order_relaxed);
+        }
+
         auto has_breakpoint(UFunction* fn, size_t index) -> bool;
         auto add_breakpoint(UFunction* fn, size_t index) -> void;
         auto add_breakpoint(const StringType& fn, size_t index) -> void;
@@ -36,9 +46,26 @@ namespace RC::GUI::KismetDebuggerMod
 
     private:
         typedef std::unordered_set<size_t> FunctionBreakpoints;
+        // One entry per offset into the function's script
+        typedef std::vector<bool> BreakpointBitmap;
 
-        std::unordered_map<UFunction*, std::shared_ptr<FunctionBreakpoints> > m_breakpoints_by_function{};
-        std::unordered_map<StringType, std::shared_ptr<FunctionBreakpoints> > m_breakpoints_by_name{};
+        struct ResolvedFunction
+        {
+            StringType full_name{};
+            // Null if the function has no breakpoints
+            std::shared_ptr<const BreakpointBitmap> bitmap{};
+        };
+
+        // Must be called with m_mutex locked
+        auto resolve(UFunction* fn) -> ResolvedFunction&;
+        auto set_breakpoint(const StringType& fn, size_t index, bool enabled) -> void;
+
+        std::mutex m_mutex{};
+        std::unordered_map<UFunction*, ResolvedFunction> m_breakpoints_by_function{};
+        std::unordered_map<StringType, FunctionBreakpoints> m_breakpoints_by_name{};
+        std::atomic<bool> m_is_armed{};
+        // Incremented whenever a breakpoint is added or removed so that per-thread lookups know to resolve again
+        std::atomic<uint32_t> m_generation{};
     };
 
     class Debugger
@@ -1,5 +1,6 @@
 #include <KismetDebugger.hpp>
 
+#include <algorithm>
 #include <vector>
 #include <unordered_map>
 #include <iostream>
@@ -43,11 +44,30 @@ namespace RC::GUI::KismetDebuggerMod
 
     BreakpointStore g_breakpoints;
 
+#if STATS && !DISABLE_PROFILER && IS_TRACY
+    // Only called for the first expression of a function, the name is resolved once per function
+    static auto get_profiler_zone_name(UFunction* fn) -> const char*
+    {
+        thread_local std::unordered_map<UFunction*, std::string> zone_names{};
+        auto [it, inserted] = zone_names.try_emplace(fn);
+        if (inserted)
+        {
+            it->second = to_string(fn->GetFullName());
+        }
+        return it->second.c_str();
+    }
+// Opens one zone per function entry, every other expression only pays for the pointer compare
+#define KismetDebuggerFunctionEntryScope(Stack)                                                                                                                \
+    const bool is_function_entry = Stack.Code() - 1 == Stack.Node()->GetScript().GetData();                                                                    \
+    const char* profiler_zone_name = is_function_entry ? get_profiler_zone_name(Stack.Node()) : "";                                                            \
+    ProfilerTransientScopeNamed(scope, profiler_zone_name, is_function_entry)
+#else
+// Transient zones are only implemented for Tracy, without it nothing is looked up at all
+#define KismetDebuggerFunctionEntryScope(Stack)
+#endif
+
     void hook_expr_internal(UObject* Context, FFrame& Stack, void* RESULT_DECL, EExprToken N) {
         UFunction* fn = Stack.Node();
-        StringType name = Stack.Node()->GetFullName();
-        ProfilerTransientScopeNamed(scope, to_string(name).c_str(), true);
-            
         size_t index = Stack.Code() - fn->GetScript().GetData() - 1;
         if (should_pause || g_breakpoints.has_breakpoint(fn, index))
         {
@@ -75,6 +95,13 @@ namespace RC::GUI::KismetDebuggerMod
     
     template <unsigned N>
     void hook_expr(UObject* Context, FFrame& Stack, void* RESULT_DECL) {
+        KismetDebuggerFunctionEntryScope(Stack);
+
+        // Every Blueprint expression goes through here, so nothing else is done unless the debugger could actually stop
+        if (!should_pause && !g_breakpoints.is_armed())
+        {
+            return GNativesOriginal[N](Context, Stack, RESULT_DECL);
+        }
         hook_expr_internal(Context, Stack, RESULT_DECL, static_cast<EExprToken>(N));
     }
 
@@ -110,114 +137,124 @@ namespace RC::GUI::KismetDebuggerMod
     auto BreakpointStore::save() -> void
     {
             JsonBreakpoints breakpoints{};
-            for (const auto& [fn, bps] : m_breakpoints_by_name) {
-                if (bps) breakpoints[to_string(fn)] = *bps;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (const auto& [fn, bps] : m_breakpoints_by_name) {
+                    breakpoints[to_string(fn)] = bps;
+                }
             }
             auto ec = glz::write_file_json(breakpoints, Debugger::m_save_path.string(), std::string{});
 
     }
-    
-    auto BreakpointStore::has_breakpoint(UFunction* fn, size_t index) -> bool
+
+    static auto make_bitmap(const std::unordered_set<size_t>& breakpoints) -> std::shared_ptr<const std::vector<bool>>
     {
-        auto [it_fn, inserted] = m_breakpoints_by_function.emplace(fn, nullptr);
-        if (!inserted)
+        if (breakpoints.empty())
         {
-            if (it_fn->second)
-                return it_fn->second->contains(index);
+            return nullptr;
         }
-        else
+        auto bitmap = std::make_shared<std::vector<bool>>(*std::ranges::max_element(breakpoints) + 1);
+        for (const auto index : breakpoints)
+        {
+            (*bitmap)[index] = true;
+        }
+        return bitmap;
+    }
+
+    auto BreakpointStore::resolve(UFunction* fn) -> ResolvedFunction&
+    {
+        auto [it_fn, inserted] = m_breakpoints_by_function.try_emplace(fn);
+        if (inserted)
         {
-            // insert null so we know we've already inserted the fn ptr into the name map
-            auto [it_name, inserted] = m_breakpoints_by_name.emplace(fn->GetFullName(), nullptr);
-            if (!inserted)
+            // Only done the first time a function is seen while breakpoints are armed
+            it_fn->second.full_name = fn->GetFullName();
+            if (auto it_name = m_breakpoints_by_name.find(it_fn->second.full_name); it_name != m_breakpoints_by_name.end())
             {
-                if (it_name->second)
-                {
-                    it_fn->second = it_name->second;
-                    return it_name->second->contains(index);
-                }
+                it_fn->second.bitmap = make_bitmap(it_name->second);
             }
         }
-        return false;
+        return it_fn->second;
     }
-    auto BreakpointStore::add_breakpoint(UFunction* fn, size_t index) -> void
-    {
-        std::shared_ptr<FunctionBreakpoints> bps;
-        auto [it_fn, inserted_fn] = m_breakpoints_by_function.emplace(fn, nullptr);
-        auto [it_name, inserted_name] = m_breakpoints_by_name.emplace(fn->GetFullName(), nullptr);
-        if (!inserted_fn && it_fn->second) bps = it_fn->second;
-        if (!inserted_name && it_name->second) bps = it_name->second;
 
-        if (!bps)
-            bps = it_fn->second = it_name->second = std::make_shared<FunctionBreakpoints>();
+    auto BreakpointStore::has_breakpoint(UFunction* fn, size_t index) -> bool
+    {
+        // Consecutive expressions are almost always in the same function, so the last lookup is kept per thread
+        thread_local UFunction* cached_fn{};
+        thread_local uint32_t cached_generation{};
+        thread_local std::shared_ptr<const BreakpointBitmap> cached_bitmap{};
 
-        bps->emplace(index);
+        const auto generation = m_generation.load(std::memory_order_acquire);
+        if (fn != cached_fn || generation != cached_generation)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            cached_bitmap = resolve(fn).bitmap;
+            cached_fn = fn;
+            cached_generation = generation;
+        }
+        return cached_bitmap && index < cached_bitmap->size() && (*cached_bitmap)[index];
+    }
 
-        save();
+    auto BreakpointStore::set_breakpoint(const StringType& fn, size_t index, bool enabled) -> void
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
 
-        /*
-        std::cout << "all breakpoints by fn ptr:" << std::endl;
-        for (const auto& fns : m_breakpoints_by_function) {
-            std::cout << (void*) fns.first << " = ";
-            if (fns.second)
-                for (const auto& bps : *fns.second) {
-                    std::cout << bps << " ";
+            std::shared_ptr<const BreakpointBitmap> bitmap{};
+            if (enabled)
+            {
+                auto& bps = m_breakpoints_by_name[fn];
+                bps.emplace(index);
+                bitmap = make_bitmap(bps);
+            }
+            else if (auto it_name = m_breakpoints_by_name.find(fn); it_name != m_breakpoints_by_name.end())
+            {
+                it_name->second.erase(index);
+                if (it_name->second.empty())
+                {
+                    m_breakpoints_by_name.erase(it_name);
                 }
-            else
-                std::cout << "null";
-            std::cout << std::endl;
-        }
-
-        std::cout << "all breakpoints by fn name:" << std::endl;
-        for (const auto& fns : m_breakpoints_by_name) {
-            std::wcout << fns.first << " = ";
-            if (fns.second)
-                for (const auto& bps : *fns.second) {
-                    std::cout << bps << " ";
+                else
+                {
+                    bitmap = make_bitmap(it_name->second);
                 }
-            else
-                std::cout << "null";
-            std::cout << std::endl;
-        }
+            }
 
-        std::cout << "all non-null breakpoints by fn name:" << std::endl;
-        for (const auto& fns : m_breakpoints_by_name) {
-            if (fns.second)
+            for (auto& [_, resolved] : m_breakpoints_by_function)
             {
-                std::wcout << fns.first << " = ";
-                for (const auto& bps : *fns.second) {
-                    std::cout << bps << " ";
+                if (resolved.full_name == fn)
+                {
+                    resolved.bitmap = bitmap;
                 }
-                std::cout << std::endl;
             }
+
+            m_is_armed.store(!m_breakpoints_by_name.empty(), std::memory_order_relaxed);
+            m_generation.fetch_add(1, std::memory_order_release);
         }
-        */
+
+        save();
+    }
+
+    auto BreakpointStore::add_breakpoint(UFunction* fn, size_t index) -> void
+    {
+        StringType full_name{};
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            full_name = resolve(fn).full_name;
+        }
+        set_breakpoint(full_name, index, true);
     }
     auto BreakpointStore::add_breakpoint(const StringType& fn, size_t index) -> void
     {
-        std::shared_ptr<FunctionBreakpoints> bps;
-        auto [it_name, inserted_name] = m_breakpoints_by_name.emplace(fn, nullptr);
-        if (!inserted_name && it_name->second) bps = it_name->second;
-
-        if (!bps)
-            bps = it_name->second = std::make_shared<FunctionBreakpoints>();
-
-        bps->emplace(index);
-
-        save();
+        set_breakpoint(fn, index, true);
     }
     auto BreakpointStore::remove_breakpoint(UFunction* fn, size_t index) -> void
     {
-        std::shared_ptr<FunctionBreakpoints> bps;
-        auto [it_fn, inserted_fn] = m_breakpoints_by_function.emplace(fn, nullptr);
-        auto [it_name, inserted_name] = m_breakpoints_by_name.emplace(fn->GetFullName(), nullptr);
-        if (!inserted_fn && it_fn->second) bps = it_fn->second;
-        if (!inserted_name && it_fn->second) bps = it_name->second;
-
-        if (bps)
-            bps->erase(index);
-
-        save();
+        StringType full_name{};
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            full_name = resolve(fn).full_name;
+        }
+        set_breakpoint(full_name, index, false);
     }
 
     Debugger::Debugger() : m_breakpoints(g_breakpoints)
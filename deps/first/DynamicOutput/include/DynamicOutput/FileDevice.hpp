@@ -1,8 +1,15 @@
 #ifndef UE4SS_REWRITTEN_FILEDEVICE_HPP
 #define UE4SS_REWRITTEN_FILEDEVICE_HPP
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
 
 #include <DynamicOutput/Common.hpp>
 #include <DynamicOutput/Macros.hpp>
@@ -20,11 +27,31 @@ namespace RC::Output
     // Open a file in append mode and keep it open until ~FileDevice
     // Whether to allow the file to be opened by other applications is not defined
     // Write one std::wstring to the file
+    // Optionally queue output & write it in batches from a background thread, see 'enable_async_writes'
     class FileDevice : public OutputDevice
     {
       private:
+        // Wakes the writer thread early once this many characters are queued
+        constexpr static size_t async_batch_size = 64 * 1024;
+        // Queued records are copied into a buffer of this many characters so that they're written in a few large writes
+        constexpr static size_t write_buffer_size = 16 * 1024;
+
         mutable File::Handle m_file;
         std::filesystem::path m_file_name_and_path;
+        // Held while writing to the file, timed so that a flush from the crash handler can't hang on a write the crashing thread was in the middle of
+        mutable std::timed_mutex m_write_mutex{};
+        // Timed for the same reason, the crashing thread could have been queueing a record
+        mutable std::timed_mutex m_queue_mutex{};
+        mutable std::condition_variable_any m_queue_cv{};
+        mutable std::vector<File::StringType> m_queued_records{};
+        // Records taken from the queue by 'flush', guarded by 'm_write_mutex'
+        // Swapped with 'm_queued_records' and cleared after writing, so both keep their capacity and a flush doesn't allocate
+        mutable std::vector<File::StringType> m_records_being_written{};
+        mutable std::unique_ptr<File::CharType[]> m_write_buffer{};
+        mutable size_t m_queued_size{};
+        mutable bool m_is_flush_requested{};
+        std::chrono::milliseconds m_flush_interval{};
+        std::jthread m_writer_thread{};
 
       protected:
         bool m_always_create_file{};
@@ -41,6 +68,13 @@ namespace RC::Output
 #else
         ~FileDevice() override
         {
+            if (m_writer_thread.joinable())
+            {
+                m_writer_thread.request_stop();
+                m_writer_thread.join();
+                flush();
+            }
+
             // Do nothing if the file was never actually constructed
             // That can happen if there was an error during the call to 'FileType::open_file()'
             if (!m_file.is_valid())
@@ -67,25 +101,160 @@ namespace RC::Output
         m_is_device_ready = true;
     }
 
+    // 'm_write_mutex' must be locked
+    auto write(File::StringViewType string_to_write) const -> void
+    {
+        if (!m_is_device_ready)
+        {
+            start_device();
+        }
+
+        m_file.write_string_to_file(string_to_write);
+    }
+
+    auto run_writer(std::stop_token stop_token) -> void
+    {
+        while (!stop_token.stop_requested())
+        {
+            {
+                std::unique_lock<std::timed_mutex> lock{m_queue_mutex};
+                m_queue_cv.wait_for(lock, stop_token, m_flush_interval, [&] {
+                    return m_is_flush_requested;
+                });
+                m_is_flush_requested = false;
+            }
+
+            // There's nobody to report a failed write to on this thread, the file internals already keep track of the error
+            try
+            {
+                flush();
+            }
+            catch (...)
+            {
+            }
+        }
+    }
+
   public:
     // OutputDevice Interface -> START
     // Due to the design of the Output system the opening of the file is done in receive instead of in the constructor
     // It's opened only once and stays open until the Output object (not the device) leaves scope
     // The destructor is responsible for closing the file
+    auto has_optional_arg() const -> bool override
+    {
+        return true;
+    }
+
     auto receive(File::StringViewType fmt) const -> void override
     {
-        if (!m_is_device_ready)
+        receive_with_optional_arg(fmt, LogLevel::Default);
+    }
+
+    // The optional arg is the log level, errors are written out straight away in async mode
+    auto receive_with_optional_arg(File::StringViewType fmt, int32_t optional_arg) const -> void override
+    {
+        if (!m_writer_thread.joinable())
         {
-            start_device();
+            std::lock_guard<std::timed_mutex> lock{m_write_mutex};
+            write(m_formatter(fmt));
+            return;
+        }
+
+        // Formatted on the calling thread so the timestamp is from when the output was sent rather than when it's written
+        auto record = m_formatter(fmt);
+        bool should_wake_writer{};
+        {
+            std::lock_guard<std::timed_mutex> lock{m_queue_mutex};
+            m_queued_size += record.size();
+            m_queued_records.emplace_back(std::move(record));
+            if (optional_arg == LogLevel::Error || m_queued_size >= async_batch_size)
+            {
+                m_is_flush_requested = true;
+                should_wake_writer = true;
+            }
+        }
+        if (should_wake_writer)
+        {
+            m_queue_cv.notify_one();
         }
+    }
 
-        // Do file output stuff here
-        // File should already be open & be ready for writing (happens in constructor)
+    // Writes everything that's queued, does nothing unless async writes are enabled
+    // Also called from the crash handler, so it gives up instead of waiting on a lock the crashed thread may hold, and doesn't allocate
+    auto flush() const -> void override
+    {
+        std::unique_lock<std::timed_mutex> write_lock{m_write_mutex, std::defer_lock};
+        if (!write_lock.try_lock_for(std::chrono::seconds(1)))
+        {
+            return;
+        }
 
-        m_file.write_string_to_file(m_formatter(fmt));
+        {
+            std::unique_lock<std::timed_mutex> queue_lock{m_queue_mutex, std::defer_lock};
+            if (!queue_lock.try_lock_for(std::chrono::seconds(1)))
+            {
+                return;
+            }
+            m_records_being_written.swap(m_queued_records);
+            m_queued_size = 0;
+        }
+        if (m_records_being_written.empty())
+        {
+            return;
+        }
+
+        try
+        {
+            size_t buffered_size{};
+            auto write_buffered = [&] {
+                if (buffered_size > 0)
+                {
+                    write(File::StringViewType{m_write_buffer.get(), buffered_size});
+                    buffered_size = 0;
+                }
+            };
+            for (const auto& record : m_records_being_written)
+            {
+                if (buffered_size + record.size() > write_buffer_size)
+                {
+                    write_buffered();
+                }
+                if (record.size() > write_buffer_size)
+                {
+                    write(record);
+                    continue;
+                }
+                std::copy(record.begin(), record.end(), m_write_buffer.get() + buffered_size);
+                buffered_size += record.size();
+            }
+            write_buffered();
+        }
+        catch (...)
+        {
+            // Records that were written before the error must not be written again by the next flush
+            m_records_being_written.clear();
+            throw;
+        }
+        m_records_being_written.clear();
     }
     // OutputDevice Interface -> END
 
+    // Queues output & writes it in batches from a background thread instead of writing on the thread that sent it
+    // The queue is written every 'flush_interval', when a lot of output is queued, when an error is sent, and when the device is destroyed
+    // Must be called before output is sent from more than one thread
+    auto enable_async_writes(std::chrono::milliseconds flush_interval) -> void
+    {
+        if (m_writer_thread.joinable())
+        {
+            return;
+        }
+        m_flush_interval = flush_interval;
+        m_write_buffer = std::make_unique<File::CharType[]>(write_buffer_size);
+        m_writer_thread = std::jthread{[this](std::stop_token stop_token) {
+            run_writer(stop_token);
+        }};
+    }
+
     auto set_file_name_and_path(const File::StringType& file_name_and_path) -> void
     {
         m_file_name_and_path = file_name_and_path;
@@ -380,6 +380,9 @@ namespace RC::Output
 
     auto RC_DYNOUT_API close_all_default_devices() -> void;
 
+    // Writes out anything the default devices have buffered, safe to call from a crash handler
+    auto RC_DYNOUT_API flush_all_default_devices() -> void;
+
     // Locks an output device so that nothing else can interact with it until the lock goes out of scope.
     // Used when you want to output multiple things with multiple calls to 'send' without interruptions.
     class Lock
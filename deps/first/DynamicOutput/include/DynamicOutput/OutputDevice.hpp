@@ -64,6 +64,9 @@ namespace RC::Output
 
         virtual auto unlock() const -> void {};
 
+        // Writes out anything the device has buffered, for devices that don't write output as soon as they receive it
+        virtual auto flush() const -> void {};
+
       public:
         auto set_formatter(Formatter new_formatter) -> void;
 
@@ -49,4 +49,12 @@ namespace RC::Output
     {
         DefaultTargets::close_all_default_devices();
     }
+
+    auto flush_all_default_devices() -> void
+    {
+        for (const auto& device : DefaultTargets::get_default_devices_ref())
+        {
+            device->flush();
+        }
+    }
 } // namespace RC::Output
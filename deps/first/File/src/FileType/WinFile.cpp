@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <fstream>
 
 #include <File/File.hpp>
@@ -386,30 +387,39 @@ namespace RC::File
 
     auto WinFile::write_string_to_file(StringViewType string_to_write) -> void
     {
-        int string_size =
-                WideCharToMultiByte(CP_UTF8, 0, FromCharTypePtr<wchar_t>(string_to_write.data()), static_cast<int>(string_to_write.size()), NULL, 0, NULL, NULL);
-        if (string_size == 0)
-        {
-            THROW_INTERNAL_FILE_ERROR(fmt::format("[WinFile::write_string_to_file] Tried writing string to file but string_size was 0. {}",
-                                                  to_string(SysError(GetLastError())).c_str()))
-        }
+        // Converted to UTF-8 in chunks on the stack instead of into one heap allocation
+        // The log is also flushed from the crash handler, where the heap may be what's broken
+        constexpr size_t max_chunk_size = 4096;
+        char utf8_buffer[max_chunk_size * 3]{};
+        const auto wide_string = FromCharTypePtr<wchar_t>(string_to_write.data());
+        size_t offset{};
+        do
+        {
+            size_t chunk_size = (std::min)(max_chunk_size, string_to_write.size() - offset);
+            // Both halves of a surrogate pair have to be converted together
+            if (offset + chunk_size < string_to_write.size() && IS_HIGH_SURROGATE(wide_string[offset + chunk_size - 1]))
+            {
+                --chunk_size;
+            }
 
-        std::string string_converted_to_utf8(string_size, 0);
-        if (WideCharToMultiByte(CP_UTF8,
-                                0,
-                                FromCharTypePtr<wchar_t>(string_to_write.data()),
-                                static_cast<int>(string_to_write.size()),
-                                &string_converted_to_utf8[0],
-                                string_size,
-                                NULL,
-                                NULL) == 0)
-        {
-            THROW_INTERNAL_FILE_ERROR(
-                    fmt::format("[WinFile::write_string_to_file] Tried writing string to file but could not convert to utf-8. {}",
-                                to_string(SysError(GetLastError())).c_str()))
-        }
+            const int string_size = WideCharToMultiByte(CP_UTF8,
+                                                        0,
+                                                        wide_string + offset,
+                                                        static_cast<int>(chunk_size),
+                                                        utf8_buffer,
+                                                        static_cast<int>(sizeof(utf8_buffer)),
+                                                        NULL,
+                                                        NULL);
+            if (string_size == 0)
+            {
+                THROW_INTERNAL_FILE_ERROR(
+                        fmt::format("[WinFile::write_string_to_file] Tried writing string to file but could not convert to utf-8. {}",
+                                    to_string(SysError(GetLastError())).c_str()))
+            }
 
-        write_to_file(*this, string_converted_to_utf8.c_str(), string_size);
+            write_to_file(*this, utf8_buffer, static_cast<DWORD>(string_size));
+            offset += chunk_size;
+        } while (offset < string_to_write.size());
     }
 
     auto WinFile::is_same_as(WinFile& other_file) -> bool
@@ -0,0 +1,128 @@
+// Times the workloads in workloads.lua interpreted and compiled to native code.
+// The file is loaded twice into separate states, once as it is and once with a '--!native' hot comment in front of it,
+// using the same compile options that LuauCompat::get_compile_options gives mod scripts.
+// Usage: LuauNativeBenchmark [path/to/workloads.lua]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include <Luau/Compiler.h>
+#include <lua.h>
+#include <luacodegen.h>
+#include <lualib.h>
+
+constexpr int runs = 5;
+constexpr const char* workload_names[] = {"numeric_loop", "grid_pathfinding", "knapsack", "projection"};
+
+struct WorkloadResult
+{
+    double best_ms{std::numeric_limits<double>::max()};
+    double value{};
+};
+
+static auto load_workloads(const std::string& source, bool native) -> lua_State*
+{
+    lua_State* L = luaL_newstate();
+    luaL_openlibs(L);
+
+    Luau::CompileOptions options{};
+    std::string chunk = source;
+    if (native)
+    {
+        luau_codegen_create(L);
+        options.optimizationLevel = 2;
+        chunk = "--!native\n" + source;
+    }
+
+    const std::string bytecode = Luau::compile(chunk, options);
+    if (luau_load(L, native ? "=native" : "=interpreted", bytecode.data(), bytecode.size(), 0) != LUA_OK)
+    {
+        std::fprintf(stderr, "Failed to load workloads: %s\n", lua_tostring(L, -1));
+        lua_close(L);
+        return nullptr;
+    }
+    if (native)
+    {
+        luau_codegen_compile(L, -1);
+    }
+
+    if (lua_pcall(L, 0, 1, 0) != LUA_OK)
+    {
+        std::fprintf(stderr, "Failed to run workloads: %s\n", lua_tostring(L, -1));
+        lua_close(L);
+        return nullptr;
+    }
+    return L;
+}
+
+// Best time out of 'runs', the best run is the one least disturbed by the rest of the machine
+static auto time_workload(lua_State* L, const char* name) -> WorkloadResult
+{
+    WorkloadResult result{};
+    for (int run = 0; run < runs; ++run)
+    {
+        lua_getfield(L, -1, name);
+        const auto start = std::chrono::steady_clock::now();
+        if (lua_pcall(L, 0, 1, 0) != LUA_OK)
+        {
+            std::fprintf(stderr, "%s failed: %s\n", name, lua_tostring(L, -1));
+            lua_pop(L, 1);
+            return {};
+        }
+        result.best_ms = std::min(result.best_ms, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        result.value = lua_tonumber(L, -1);
+        lua_pop(L, 1);
+    }
+    return result;
+}
+
+auto main(int argc, char** argv) -> int
+{
+    const char* path = argc > 1 ? argv[1] : LUAU_NATIVE_BENCHMARK_WORKLOADS;
+    std::ifstream file{path, std::ios::binary};
+    if (!file)
+    {
+        std::fprintf(stderr, "Can't open %s\n", path);
+        return 1;
+    }
+    std::stringstream source{};
+    source << file.rdbuf();
+
+    if (!luau_codegen_supported())
+    {
+        std::fprintf(stderr, "Native code isn't supported on this CPU\n");
+        return 1;
+    }
+
+    lua_State* interpreted = load_workloads(source.str(), false);
+    lua_State* native = load_workloads(source.str(), true);
+    if (!interpreted || !native)
+    {
+        return 1;
+    }
+
+    bool results_match{true};
+    std::printf("Luau benchmark, best of %d runs, interpreted vs native\n", runs);
+    for (const char* name : workload_names)
+    {
+        const auto interpreted_result = time_workload(interpreted, name);
+        const auto native_result = time_workload(native, name);
+        const bool match = interpreted_result.value == native_result.value;
+        results_match &= match;
+        std::printf("  %-18s %8.2f ms -> %8.2f ms  %.2fx%s\n",
+                    name,
+                    interpreted_result.best_ms,
+                    native_result.best_ms,
+                    interpreted_result.best_ms / native_result.best_ms,
+                    match ? "" : " (RESULTS DIFFER)");
+    }
+
+    lua_close(interpreted);
+    lua_close(native);
+    return results_match ? 0 : 1;
+}
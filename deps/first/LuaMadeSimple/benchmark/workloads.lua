@@ -0,0 +1,122 @@
+-- Workloads for comparing interpreted and native Luau, see LuauNativeBenchmark.cpp
+-- The benchmark loads this file twice, once as it is and once with a '--!native' hot comment in front of it, so it must not have one itself
+
+local Workloads = {}
+
+-- Arithmetic-bound loop
+function Workloads.numeric_loop(): number
+    local x = 0.5
+    local acc = 0.0
+    for i = 1, 2000000 do
+        acc = acc * 0.999 + x * i
+        x = x * 1.0000001
+    end
+    return acc
+end
+
+-- A* on an open grid with a few walls, table heavy
+function Workloads.grid_pathfinding(): number
+    local size = 60
+    local walls = {}
+    for y = 1, size do
+        for x = 1, size do
+            walls[(y - 1) * size + x] = (x % 7 == 0 and y % 11 ~= 0)
+        end
+    end
+
+    local goal = size * size
+    local g = { [1] = 0 }
+    local open = { 1 }
+    local closed = {}
+    local expanded = 0
+
+    local function heuristic(index: number): number
+        local x = (index - 1) % size + 1
+        local y = (index - 1) // size + 1
+        return (size - x) + (size - y)
+    end
+
+    while #open > 0 do
+        local best_i = 1
+        local best_f = g[open[1]] + heuristic(open[1])
+        for i = 2, #open do
+            local f = g[open[i]] + heuristic(open[i])
+            if f < best_f then
+                best_i = i
+                best_f = f
+            end
+        end
+
+        local current = open[best_i]
+        open[best_i] = open[#open]
+        open[#open] = nil
+        if current == goal then
+            break
+        end
+        if closed[current] then
+            continue
+        end
+        closed[current] = true
+        expanded += 1
+
+        local x = (current - 1) % size + 1
+        local neighbors = {
+            x > 1 and current - 1 or nil,
+            x < size and current + 1 or nil,
+            current > size and current - size or nil,
+            current <= goal - size and current + size or nil,
+        }
+        for i = 1, 4 do
+            local neighbor = neighbors[i]
+            if neighbor and not walls[neighbor] and not closed[neighbor] then
+                local cost = g[current] + 1
+                if g[neighbor] == nil or cost < g[neighbor] then
+                    g[neighbor] = cost
+                    table.insert(open, neighbor)
+                end
+            end
+        end
+    end
+    return expanded
+end
+
+-- 0/1 knapsack, array indexing in a tight loop
+function Workloads.knapsack(): number
+    local capacity = 1000
+    local best = table.create(capacity + 1, 0)
+    for item = 1, 200 do
+        local weight = (item * 37) % 97 + 1
+        local value = (item * 53) % 101 + 1
+        for c = capacity, weight, -1 do
+            local candidate = best[c - weight + 1] + value
+            if candidate > best[c + 1] then
+                best[c + 1] = candidate
+            end
+        end
+    end
+    return best[capacity + 1]
+end
+
+-- World to screen projection, the kind of math an ESP or HUD mod does every frame
+function Workloads.projection(): number
+    local fov_scale = 1 / math.tan(math.rad(90) / 2)
+    local half_width, half_height = 960, 540
+    local on_screen = 0
+    for i = 1, 200000 do
+        local px, py, pz = (i % 200) - 100, (i % 130) - 65, (i % 500) + 1
+        local yaw = i * 0.001
+        local cos_yaw, sin_yaw = math.cos(yaw), math.sin(yaw)
+        local vx = px * cos_yaw - pz * sin_yaw
+        local vz = px * sin_yaw + pz * cos_yaw
+        if vz > 0.1 then
+            local sx = half_width + vx * fov_scale * half_width / vz
+            local sy = half_height - py * fov_scale * half_width / vz
+            if sx >= 0 and sx < half_width * 2 and sy >= 0 and sy < half_height * 2 then
+                on_screen += 1
+            end
+        end
+    end
+    return on_screen
+end
+
+return Workloads
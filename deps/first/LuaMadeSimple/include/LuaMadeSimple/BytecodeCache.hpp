@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <Luau/Compiler.h>
+
+#include <LuaMadeSimple/Common.hpp>
+
+namespace RC::LuaMadeSimple::BytecodeCache
+{
+    // Compiles 'source' to Luau bytecode, or returns the bytecode from an earlier compilation of the same source with the same options
+    // Failed compilations aren't cached, the result is the error in the same format that Luau::compile returns it in
+    RC_LMS_API auto compile(std::string_view source, const Luau::CompileOptions& options = {}) -> std::shared_ptr<const std::string>;
+
+    // Bytecode is also written to and read from this directory so that it survives restarts
+    // An empty path, which is the default, keeps the cache in memory only
+    // 'build_id' is part of every cache key, it should change whenever the compiler can produce different bytecode, e.g. on every release
+    RC_LMS_API auto set_directory(const std::filesystem::path& directory, std::string_view build_id = {}) -> void;
+
+    // Deletes files in the cache directory that were written by a different build, or that haven't been used for 'max_unused_age'
+    // Every edit of a script leaves the bytecode of the old version behind, so this is meant to be called once on startup
+    RC_LMS_API auto prune(std::chrono::hours max_unused_age) -> void;
+
+    // Drops everything that's cached in memory, files on disk are left alone
+    RC_LMS_API auto clear() -> void;
+} // namespace RC::LuaMadeSimple::BytecodeCache
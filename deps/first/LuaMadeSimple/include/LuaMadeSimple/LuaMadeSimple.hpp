@@ -364,6 +364,13 @@ namespace RC::LuaMadeSimple
              */
             auto make_global(std::string_view table_name) const -> void;
 
+            /**
+             * Make a table read-only
+             * Assigning to any of its fields from Lua raises an error, use it for tables of constants that every script shares
+             * Must be called after all pairs have been added and before the table is made global or local
+             */
+            auto make_readonly() const -> void;
+
           public:
             // Finds a value corresponding to the key at the top of the Lua stack
             // Use the Lua::get_<type>() functions to retrieve the value (i.e: lua.get_integer())
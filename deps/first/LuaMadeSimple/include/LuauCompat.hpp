@@ -11,8 +11,14 @@
 
 // Include Luau compiler for bytecode compilation
 #include <Luau/Compiler.h>
+#include <LuaMadeSimple/BytecodeCache.hpp>
 
+// Include Luau code generator for scripts that opt into native execution
+#include <luacodegen.h>
+
+#include <atomic>
 #include <string>
+#include <string_view>
 #include <cstring>
 #include <cstdio>
 #include <functional>
@@ -330,6 +336,130 @@ inline int lua_setiuservalue(lua_State* L, int idx, int n)
 // Luau requires bytecode compilation before loading
 // ============================================================================
 
+namespace LuauCompat
+{
+    // Registry table holding every chunk loaded from a file while a debugger is listening, keyed by chunk name ("@path")
+    // Luau breakpoints are set with lua_breakpoint which needs the chunk function, so the debugger looks them up here
+    constexpr const char* LOADED_CHUNKS_REGISTRY_KEY = "ue4ss_loaded_chunks";
+
+    // Called after a chunk has been added to the registry, with the chunk function still at the top of the stack
+    using ChunkLoadedCallback = void (*)(lua_State* L);
+    inline std::atomic<ChunkLoadedCallback> s_chunk_loaded_callback{nullptr};
+
+    // Expects the freshly loaded chunk function at the top of the stack, leaves the stack unchanged
+    // Chunks are only tracked while a debugger is listening, the registry keeps them alive for as long as the state exists
+    inline void track_loaded_chunk(lua_State* L, const char* chunk_name)
+    {
+        auto callback = s_chunk_loaded_callback.load();
+        if (!callback || !chunk_name || chunk_name[0] != '@' || !lua_checkstack(L, 3))
+            return;
+
+        lua_getfield(L, LUA_REGISTRYINDEX, LOADED_CHUNKS_REGISTRY_KEY);
+        if (!lua_istable(L, -1))
+        {
+            lua_pop(L, 1);
+            lua_newtable(L);
+            lua_pushvalue(L, -1);
+            lua_setfield(L, LUA_REGISTRYINDEX, LOADED_CHUNKS_REGISTRY_KEY);
+        }
+
+        // The same file can be loaded more than once, e.g. by a hot reload, so every chunk name maps to a list of functions
+        lua_getfield(L, -1, chunk_name);
+        if (!lua_istable(L, -1))
+        {
+            lua_pop(L, 1);
+            lua_newtable(L);
+            lua_pushvalue(L, -1);
+            lua_setfield(L, -3, chunk_name);
+        }
+
+        int num_chunks = lua_objlen(L, -1);
+        lua_pushvalue(L, -3);
+        lua_rawseti(L, -2, num_chunks + 1);
+        lua_pop(L, 2);
+
+        callback(L);
+    }
+
+    // Registry flag set once the code generator has been created for a state, it's shared by every thread of that state
+    constexpr const char* NATIVE_CODEGEN_REGISTRY_KEY = "ue4ss_native_codegen";
+
+    // Scripts starting with a '--!native' hot comment are only compiled to native code while this is set
+    inline std::atomic<bool> s_native_codegen_allowed{false};
+
+    // Returns true if the source starts with a '--!native' hot comment
+    // Like the Luau compiler, only comments before the first line of code are considered
+    inline bool has_native_hot_comment(std::string_view source)
+    {
+        size_t pos = 0;
+        while (pos < source.size())
+        {
+            size_t line_end = source.find('\n', pos);
+            if (line_end == std::string_view::npos)
+                line_end = source.size();
+
+            std::string_view line = source.substr(pos, line_end - pos);
+            pos = line_end + 1;
+
+            const size_t first = line.find_first_not_of(" \t\r\v\f");
+            if (first == std::string_view::npos)
+                continue;
+            line = line.substr(first);
+
+            if (!line.starts_with("--") || line.starts_with("--["))
+                return false;
+
+            if (line.starts_with("--!"))
+            {
+                std::string_view name = line.substr(3);
+                name = name.substr(0, name.find_first_of(" \t\r\v\f"));
+                if (name == "native")
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    // Returns true if the script will be compiled to native code when it's loaded
+    // False if native code isn't allowed or isn't supported on this CPU, in which case the script is interpreted
+    inline bool is_native_script(std::string_view source)
+    {
+        return s_native_codegen_allowed.load(std::memory_order_relaxed) && has_native_hot_comment(source) && luau_codegen_supported();
+    }
+
+    // The options luaL_loadbuffer compiles with, anything compiling ahead of time must use the same ones to share the cached bytecode
+    inline Luau::CompileOptions get_compile_options(bool is_native)
+    {
+        // Native scripts are compiled with inlining and other optimizations that make them harder to debug, which is part of opting in
+        Luau::CompileOptions options{};
+        if (is_native)
+            options.optimizationLevel = 2;
+        return options;
+    }
+
+    // Compiles the source into the bytecode cache without a Lua state, safe to call from any thread
+    // luaL_loadbuffer with the same source then only has to load the bytecode
+    inline std::shared_ptr<const std::string> precompile(std::string_view source)
+    {
+        return RC::LuaMadeSimple::BytecodeCache::compile(source, get_compile_options(is_native_script(source)));
+    }
+
+    // Creates the code generator for the state the first time a native script is loaded into it
+    inline void prepare_native_codegen(lua_State* L)
+    {
+        lua_getfield(L, LUA_REGISTRYINDEX, NATIVE_CODEGEN_REGISTRY_KEY);
+        const bool is_created = lua_toboolean(L, -1);
+        lua_pop(L, 1);
+
+        if (!is_created)
+        {
+            luau_codegen_create(L);
+            lua_pushboolean(L, 1);
+            lua_setfield(L, LUA_REGISTRYINDEX, NATIVE_CODEGEN_REGISTRY_KEY);
+        }
+    }
+}
+
 inline int luaL_loadstring(lua_State* L, const char* s)
 {
     size_t len = strlen(s);
@@ -355,21 +485,37 @@ inline int luaL_loadstring(lua_State* L, const char* s)
 
 inline int luaL_loadbuffer(lua_State* L, const char* buff, size_t sz, const char* name)
 {
+    const std::string_view source(buff, sz);
+
+    const bool is_native = LuauCompat::is_native_script(source);
+    if (is_native)
+        LuauCompat::prepare_native_codegen(L);
+
     // Compile the source to bytecode
-    std::string bytecode = Luau::compile(std::string(buff, sz));
+    // Mod scripts are loaded again on every hot reload, so unchanged files reuse the bytecode from the last time they were compiled
+    auto bytecode = RC::LuaMadeSimple::BytecodeCache::compile(source, LuauCompat::get_compile_options(is_native));
 
     // Check for compilation errors
-    if (bytecode.empty() || bytecode[0] == 0)
+    if (bytecode->empty() || (*bytecode)[0] == 0)
     {
-        if (bytecode.size() > 1)
-            lua_pushstring(L, bytecode.c_str() + 1);
+        if (bytecode->size() > 1)
+            lua_pushstring(L, bytecode->c_str() + 1);
         else
             lua_pushstring(L, "compilation failed");
         return LUA_ERRSYNTAX;
     }
 
     // Load the bytecode
-    return luau_load(L, name, bytecode.data(), bytecode.size(), 0);
+    int result = luau_load(L, name, bytecode->data(), bytecode->size(), 0);
+    if (result == LUA_OK)
+    {
+        // Compiles the chunk and every function in it, functions the compiler doesn't consider worth it stay interpreted
+        if (is_native)
+            luau_codegen_compile(L, -1);
+
+        LuauCompat::track_loaded_chunk(L, name);
+    }
+    return result;
 }
 
 inline int luaL_loadfile(lua_State* L, const char* filename)
@@ -0,0 +1,320 @@
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include <Luau/Bytecode.h>
+#include <LuaMadeSimple/BytecodeCache.hpp>
+#include <fmt/core.h>
+
+namespace RC::LuaMadeSimple::BytecodeCache
+{
+    constexpr static char cache_file_magic[8] = {'U', 'E', '4', 'S', 'S', 'L', 'B', 'C'};
+    constexpr static uint32_t cache_file_version = 2;
+
+    // Files read from disk have their write time refreshed once it's older than this, 'prune' deletes files by that time
+    constexpr static std::chrono::hours touch_interval{24};
+    // Temporary files older than this were left behind by a process that didn't finish writing them
+    constexpr static std::chrono::hours max_temp_file_age{1};
+
+    // Hot-reloading a script that's being edited leaves the bytecode of every previous version behind, so the memory cache is
+    // dropped once it grows past this
+    constexpr static size_t max_memory_cache_size = 64 * 1024 * 1024;
+
+    struct CacheEntry
+    {
+        size_t source_size{};
+        std::shared_ptr<const std::string> bytecode{};
+    };
+
+    static std::mutex s_cache_mutex{};
+    static std::unordered_map<uint64_t, CacheEntry> s_entries{};
+    static size_t s_memory_cache_size{};
+    static std::filesystem::path s_directory{};
+    static std::atomic<uint64_t> s_build_hash{};
+
+    static auto hash_bytes(const void* data, size_t size, uint64_t hash) -> uint64_t
+    {
+        const auto bytes = static_cast<const uint8_t*>(data);
+        size_t offset = 0;
+        for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t))
+        {
+            uint64_t word{};
+            std::memcpy(&word, bytes + offset, sizeof(word));
+            hash = (hash ^ word) * 0x9E3779B97F4A7C15;
+            hash ^= hash >> 29;
+        }
+        for (; offset < size; ++offset)
+        {
+            hash = (hash ^ bytes[offset]) * 0x100000001B3;
+        }
+        return hash;
+    }
+
+    template <typename T>
+    static auto hash_value(const T& value, uint64_t hash) -> uint64_t
+    {
+        return hash_bytes(&value, sizeof(T), hash);
+    }
+
+    static auto hash_string(const char* string, uint64_t hash) -> uint64_t
+    {
+        return string ? hash_bytes(string, std::strlen(string) + 1, hash) : hash_value(uint8_t{0xFF}, hash);
+    }
+
+    static auto hash_string_list(const char* const* strings, uint64_t hash) -> uint64_t
+    {
+        for (; strings && *strings; ++strings)
+        {
+            hash = hash_string(*strings, hash);
+        }
+        return hash_value(uint8_t{0xFF}, hash);
+    }
+
+    static auto get_key(std::string_view source, const Luau::CompileOptions& options) -> uint64_t
+    {
+        uint64_t hash = hash_value(cache_file_version, 0xCBF29CE484222325);
+        hash = hash_value(s_build_hash.load(), hash);
+        hash = hash_value(static_cast<int>(LBC_VERSION_TARGET), hash);
+        hash = hash_value(options.optimizationLevel, hash);
+        hash = hash_value(options.debugLevel, hash);
+        hash = hash_value(options.typeInfoLevel, hash);
+        hash = hash_value(options.coverageLevel, hash);
+        hash = hash_string(options.vectorLib, hash);
+        hash = hash_string(options.vectorCtor, hash);
+        hash = hash_string(options.vectorType, hash);
+        hash = hash_string_list(options.mutableGlobals, hash);
+        hash = hash_string_list(options.userdataTypes, hash);
+        hash = hash_string_list(options.librariesWithKnownMembers, hash);
+        hash = hash_string_list(options.disabledBuiltins, hash);
+        // Callbacks can only be told apart by address, which means bytecode compiled with them is rarely reused from disk
+        hash = hash_value(options.libraryMemberTypeCb, hash);
+        hash = hash_value(options.libraryMemberConstantCb, hash);
+        return hash_bytes(source.data(), source.size(), hash);
+    }
+
+    template <typename T>
+    static auto read_value(std::ifstream& file, T& value) -> bool
+    {
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    template <typename T>
+    static auto write_value(std::ofstream& file, const T& value) -> void
+    {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    static auto get_file_path(const std::filesystem::path& directory, uint64_t key) -> std::filesystem::path
+    {
+        return directory / fmt::format("luau_{:016X}.bin", key);
+    }
+
+    // Reads the part of the header that's the same for every file written by this build
+    static auto read_header(std::ifstream& file) -> bool
+    {
+        char magic[sizeof(cache_file_magic)]{};
+        uint32_t version{};
+        uint64_t build_hash{};
+        file.read(magic, sizeof(magic));
+        return file && std::memcmp(magic, cache_file_magic, sizeof(magic)) == 0 && read_value(file, version) && version == cache_file_version &&
+               read_value(file, build_hash) && build_hash == s_build_hash.load();
+    }
+
+    static auto read_from_disk(const std::filesystem::path& directory, uint64_t key, size_t source_size) -> std::shared_ptr<const std::string>
+    {
+        const auto file_path = get_file_path(directory, key);
+        std::ifstream file{file_path, std::ios::binary};
+        if (!file)
+        {
+            return nullptr;
+        }
+
+        uint64_t file_key{};
+        uint64_t file_source_size{};
+        uint64_t bytecode_size{};
+        if (!read_header(file) || !read_value(file, file_key) || file_key != key || !read_value(file, file_source_size) ||
+            file_source_size != source_size || !read_value(file, bytecode_size) || bytecode_size == 0)
+        {
+            return nullptr;
+        }
+
+        auto bytecode = std::make_shared<std::string>(bytecode_size, '\0');
+        if (!file.read(bytecode->data(), bytecode_size) || (*bytecode)[0] == 0)
+        {
+            return nullptr;
+        }
+        file.close();
+
+        // Marks the file as used so that 'prune' keeps it, at most once per interval to avoid a write on every load
+        std::error_code ec{};
+        const auto now = std::filesystem::file_time_type::clock::now();
+        if (const auto last_write_time = std::filesystem::last_write_time(file_path, ec); !ec && now - last_write_time > touch_interval)
+        {
+            std::filesystem::last_write_time(file_path, now, ec);
+        }
+        return bytecode;
+    }
+
+    static auto write_to_disk(const std::filesystem::path& directory, uint64_t key, size_t source_size, const std::string& bytecode) -> void
+    {
+        // Writing to a temporary file first so that another process loading the same script never sees a half-written file
+        std::error_code ec{};
+        std::filesystem::create_directories(directory, ec);
+        const auto file_path = get_file_path(directory, key);
+        auto temp_file_path = file_path;
+        temp_file_path += fmt::format(".{}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+        {
+            std::ofstream file{temp_file_path, std::ios::binary | std::ios::trunc};
+            if (!file)
+            {
+                return;
+            }
+
+            file.write(cache_file_magic, sizeof(cache_file_magic));
+            write_value(file, cache_file_version);
+            write_value(file, s_build_hash.load());
+            write_value(file, key);
+            write_value(file, static_cast<uint64_t>(source_size));
+            write_value(file, static_cast<uint64_t>(bytecode.size()));
+            file.write(bytecode.data(), bytecode.size());
+
+            if (!file)
+            {
+                file.close();
+                std::filesystem::remove(temp_file_path, ec);
+                return;
+            }
+        }
+
+        std::filesystem::rename(temp_file_path, file_path, ec);
+        if (ec)
+        {
+            std::filesystem::remove(temp_file_path, ec);
+        }
+    }
+
+    auto compile(std::string_view source, const Luau::CompileOptions& options) -> std::shared_ptr<const std::string>
+    {
+        const uint64_t key = get_key(source, options);
+
+        std::filesystem::path directory{};
+        {
+            std::lock_guard<std::mutex> lock(s_cache_mutex);
+            if (auto it = s_entries.find(key); it != s_entries.end() && it->second.source_size == source.size())
+            {
+                return it->second.bytecode;
+            }
+            directory = s_directory;
+        }
+
+        // Compiling and disk access are done without the lock so that scripts can be loaded from multiple threads
+        std::shared_ptr<const std::string> bytecode{};
+        if (!directory.empty())
+        {
+            bytecode = read_from_disk(directory, key, source.size());
+        }
+        if (!bytecode)
+        {
+            auto compiled = std::make_shared<std::string>(Luau::compile(std::string{source}, options));
+
+            // A leading zero means compilation failed and the rest is the error message
+            if (compiled->empty() || (*compiled)[0] == 0)
+            {
+                return compiled;
+            }
+            if (!directory.empty())
+            {
+                write_to_disk(directory, key, source.size(), *compiled);
+            }
+            bytecode = std::move(compiled);
+        }
+
+        std::lock_guard<std::mutex> lock(s_cache_mutex);
+        if (s_memory_cache_size + bytecode->size() > max_memory_cache_size)
+        {
+            s_entries.clear();
+            s_memory_cache_size = 0;
+        }
+        if (s_entries.insert_or_assign(key, CacheEntry{source.size(), bytecode}).second)
+        {
+            s_memory_cache_size += bytecode->size();
+        }
+        return bytecode;
+    }
+
+    auto set_directory(const std::filesystem::path& directory, std::string_view build_id) -> void
+    {
+        std::lock_guard<std::mutex> lock(s_cache_mutex);
+        s_directory = directory;
+        if (const uint64_t build_hash = hash_bytes(build_id.data(), build_id.size(), 0xCBF29CE484222325); build_hash != s_build_hash.load())
+        {
+            // Everything in memory was compiled under the old keys
+            s_build_hash = build_hash;
+            s_entries.clear();
+            s_memory_cache_size = 0;
+        }
+    }
+
+    auto prune(std::chrono::hours max_unused_age) -> void
+    {
+        std::filesystem::path directory{};
+        {
+            std::lock_guard<std::mutex> lock(s_cache_mutex);
+            directory = s_directory;
+        }
+        if (directory.empty())
+        {
+            return;
+        }
+
+        std::error_code ec{};
+        const auto now = std::filesystem::file_time_type::clock::now();
+        for (std::filesystem::directory_iterator it{directory, ec}, end{}; !ec && it != end; it.increment(ec))
+        {
+            const auto& path = it->path();
+            std::error_code file_ec{};
+            if (!it->is_regular_file(file_ec) || !path.filename().string().starts_with("luau_"))
+            {
+                continue;
+            }
+
+            const auto last_write_time = it->last_write_time(file_ec);
+            if (file_ec)
+            {
+                continue;
+            }
+
+            bool is_stale{};
+            if (path.extension() == ".tmp")
+            {
+                is_stale = now - last_write_time > max_temp_file_age;
+            }
+            else if (path.extension() == ".bin")
+            {
+                is_stale = now - last_write_time > max_unused_age;
+                if (!is_stale)
+                {
+                    // Files from another build or cache format are never read again
+                    std::ifstream file{path, std::ios::binary};
+                    is_stale = file && !read_header(file);
+                }
+            }
+
+            if (is_stale)
+            {
+                std::filesystem::remove(path, file_ec);
+            }
+        }
+    }
+
+    auto clear() -> void
+    {
+        std::lock_guard<std::mutex> lock(s_cache_mutex);
+        s_entries.clear();
+        s_memory_cache_size = 0;
+    }
+} // namespace RC::LuaMadeSimple::BytecodeCache
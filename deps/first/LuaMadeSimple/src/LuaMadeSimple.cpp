@@ -1,6 +1,9 @@
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <mutex>
 #include <stdexcept>
+#include <unordered_map>
 #include <vector>
 
 #include <LuaMadeSimple/LuaMadeSimple.hpp>
@@ -13,7 +16,55 @@ namespace RC::LuaMadeSimple
     // All lua instances, lua_State* are stored in the Lua class
     static std::unordered_map<lua_State*, std::shared_ptr<Lua>> lua_instances;
 
-    static std::vector<std::optional<Lua::LuaFunction>> lua_functions;
+    // Functions are registered from whichever thread sets up a state, and called from every thread that runs Lua without a lock
+    // They're stored in fixed size chunks that never move, so a function can be read while another one is being added
+    constexpr static size_t lua_function_chunk_size = 512;
+    constexpr static size_t max_lua_function_chunks = 256;
+    static std::array<std::atomic<Lua::LuaFunction*>, max_lua_function_chunks> lua_function_chunks{};
+    static std::atomic<size_t> lua_function_count{};
+
+    // Every state registers the same functions, and every hot reload registers them again
+    // Each function is only stored once so that 'lua_function_chunks' stops growing once the first state has been set up
+    static std::unordered_map<Lua::LuaFunction, size_t> lua_function_ids;
+    static std::mutex lua_functions_mutex;
+
+    static auto get_lua_function_id(Lua::LuaFunction function) -> size_t
+    {
+        std::lock_guard<std::mutex> lock(lua_functions_mutex);
+        if (auto it = lua_function_ids.find(function); it != lua_function_ids.end())
+        {
+            return it->second;
+        }
+
+        const size_t id = lua_function_count.load(std::memory_order_relaxed);
+        const size_t chunk_index = id / lua_function_chunk_size;
+        if (chunk_index >= max_lua_function_chunks)
+        {
+            throw std::runtime_error{"[get_lua_function_id] Too many functions registered"};
+        }
+
+        auto chunk = lua_function_chunks[chunk_index].load(std::memory_order_relaxed);
+        if (!chunk)
+        {
+            // Chunks live for as long as the process, states can call into them until the very end
+            chunk = new Lua::LuaFunction[lua_function_chunk_size]{};
+            lua_function_chunks[chunk_index].store(chunk, std::memory_order_release);
+        }
+        chunk[id % lua_function_chunk_size] = function;
+        lua_function_count.store(id + 1, std::memory_order_release);
+
+        lua_function_ids.emplace(function, id);
+        return id;
+    }
+
+    static auto find_lua_function(size_t id) -> Lua::LuaFunction
+    {
+        if (id >= lua_function_count.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+        return lua_function_chunks[id / lua_function_chunk_size].load(std::memory_order_acquire)[id % lua_function_chunk_size];
+    }
 
     // Current errors for all lua states
     static std::unordered_map<lua_State*, std::string> lua_state_errors;
@@ -274,11 +325,9 @@ namespace RC::LuaMadeSimple
 
     auto Lua::Table::add_function_value_internal(Lua::LuaFunction function) const -> void
     {
-        lua_functions.emplace_back(LuaFunction{function});
-
         // Upvalues for process_lua_function
         // Upvalue #1: Function id
-        lua_pushinteger(get_lua_instance().get_lua_state(), lua_functions.size() - 1);
+        lua_pushinteger(get_lua_instance().get_lua_state(), static_cast<lua_Integer>(get_lua_function_id(function)));
 
         // Upvalue #2: Function type
         lua_pushinteger(get_lua_instance().get_lua_state(), static_cast<lua_Integer>(m_has_userdata ? LuaFunctionType::Local : LuaFunctionType::Table));
@@ -306,6 +355,11 @@ namespace RC::LuaMadeSimple
     {
     }
 
+    auto Lua::Table::make_readonly() const -> void
+    {
+        lua_setreadonly(get_lua_instance().get_lua_state(), -1, true);
+    }
+
     auto Lua::Table::make_global(std::string_view table_name) const -> void
     {
         lua_setglobal(get_lua_instance().get_lua_state(), table_name.data());
@@ -720,10 +774,8 @@ namespace RC::LuaMadeSimple
 
     auto Lua::register_function(const std::string& name, const LuaFunction& function) const -> void
     {
-        lua_functions.emplace_back(LuaFunction{function});
-
         // Upvalue for process_lua_function
-        lua_pushinteger(get_lua_state(), lua_functions.size() - 1);
+        lua_pushinteger(get_lua_state(), static_cast<lua_Integer>(get_lua_function_id(function)));
         lua_pushinteger(get_lua_state(), static_cast<lua_Integer>(LuaFunctionType::Global));
 
         lua_pushcclosure(get_lua_state(), &process_lua_function, 2);
@@ -1200,18 +1252,14 @@ namespace RC::LuaMadeSimple
 
         Lua& data_owner = *lua_instances.find(lua_state)->second;
 
-        if (func_id > lua_functions.size())
-        {
-            throw_error(lua_state, fmt::format("[process_lua_function] There was no global function with the id '{}' inside the lua_functions vector", func_id));
-        }
-
-        if (!lua_functions[func_id].has_value())
+        const auto function = find_lua_function(func_id);
+        if (!function)
         {
-            throw_error(lua_state, "[process_lua_function] The optional was empty");
+            throw_error(lua_state, fmt::format("[process_lua_function] There was no global function with the id '{}' inside the lua_functions table", func_id));
         }
 
         return TRY(lua_state, [&] {
-            auto return_value = lua_functions[func_id].value()(data_owner);
+            auto return_value = function(data_owner);
             for (const auto& post_process_callback : data_owner.m_post_function_process_callbacks)
             {
                 post_process_callback(data_owner);
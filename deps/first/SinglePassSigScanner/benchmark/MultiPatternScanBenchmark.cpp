@@ -0,0 +1,173 @@
+// Scans a synthetic 200 MB buffer for a set of AOB patterns, once per pattern with a masked compare (what the StdFind
+// scan method does for every signature), and once with MultiPatternMatcher for every kernel the CPU supports.
+// Usage: MultiPatternScanBenchmark [buffer size in MB] [number of patterns]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include <SigScanner/MultiPatternMatcher.hpp>
+
+using namespace RC;
+
+struct BenchmarkPattern
+{
+    std::vector<uint8_t> bytes{};
+    std::vector<uint8_t> mask{};
+};
+
+// Opcode & prefix bytes that are common in x64 code, so that the first-byte filter sees roughly as many candidates as it would in a game module
+static constexpr uint8_t s_common_bytes[] = {0x48, 0x8B, 0x89, 0xE8, 0x0F, 0x00, 0xFF, 0xC3, 0x4C, 0x85, 0x33, 0x44, 0x24, 0x8D};
+
+static auto random_code_byte(std::mt19937& rng) -> uint8_t
+{
+    if (std::uniform_int_distribution<int>{0, 9}(rng) < 4)
+    {
+        return s_common_bytes[std::uniform_int_distribution<size_t>{0, std::size(s_common_bytes) - 1}(rng)];
+    }
+    return static_cast<uint8_t>(std::uniform_int_distribution<int>{0, 255}(rng));
+}
+
+static auto make_patterns(std::mt19937& rng, size_t count) -> std::vector<BenchmarkPattern>
+{
+    std::vector<BenchmarkPattern> patterns{};
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto& pattern = patterns.emplace_back();
+        const auto size = std::uniform_int_distribution<size_t>{12, 32}(rng);
+        for (size_t byte_index = 0; byte_index < size; ++byte_index)
+        {
+            // Patterns never start with a wildcard, and are about a quarter wildcards like real signatures are (relative offsets, displacements)
+            const bool is_wildcard = byte_index > 0 && std::uniform_int_distribution<int>{0, 3}(rng) == 0;
+            pattern.bytes.emplace_back(is_wildcard ? 0 : random_code_byte(rng));
+            pattern.mask.emplace_back(is_wildcard ? 0x00 : 0xFF);
+        }
+    }
+    return patterns;
+}
+
+static auto matches_at(const BenchmarkPattern& pattern, const uint8_t* address) -> bool
+{
+    for (size_t i = 0; i < pattern.bytes.size(); ++i)
+    {
+        if ((address[i] & pattern.mask[i]) != pattern.bytes[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static auto seconds_since(std::chrono::steady_clock::time_point start) -> double
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static auto kernel_name(MultiPatternMatcher::Kernel kernel) -> const char*
+{
+    switch (kernel)
+    {
+    case MultiPatternMatcher::Kernel::Scalar:
+        return "Scalar";
+    case MultiPatternMatcher::Kernel::SSSE3:
+        return "SSSE3";
+    case MultiPatternMatcher::Kernel::AVX2:
+        return "AVX2";
+    }
+    return "Unknown";
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    const size_t buffer_size = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200) * 1024 * 1024;
+    const size_t num_patterns = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 64;
+    if (buffer_size == 0 || num_patterns == 0)
+    {
+        std::printf("Usage: %s [buffer size in MB] [number of patterns]\n", argv[0]);
+        return 1;
+    }
+
+    std::mt19937 rng{1337};
+    std::vector<uint8_t> buffer(buffer_size);
+    for (auto& byte : buffer)
+    {
+        byte = random_code_byte(rng);
+    }
+
+    // Plant every pattern a few times so that both scanners have real matches to report
+    const auto patterns = make_patterns(rng, num_patterns);
+    for (const auto& pattern : patterns)
+    {
+        for (int copy = 0; copy < 4; ++copy)
+        {
+            const auto offset = std::uniform_int_distribution<size_t>{0, buffer.size() - pattern.bytes.size()}(rng);
+            for (size_t i = 0; i < pattern.bytes.size(); ++i)
+            {
+                if (pattern.mask[i])
+                {
+                    buffer[offset + i] = pattern.bytes[i];
+                }
+            }
+        }
+    }
+
+    std::printf("Scanning %zu MB for %zu patterns\n", buffer_size / 1024 / 1024, num_patterns);
+    const auto megabytes = static_cast<double>(buffer_size) / 1024.0 / 1024.0;
+
+    size_t baseline_matches{};
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& pattern : patterns)
+    {
+        const auto* end = buffer.data() + buffer.size() - pattern.bytes.size();
+        for (const auto* address = buffer.data(); address <= end; ++address)
+        {
+            if (matches_at(pattern, address))
+            {
+                ++baseline_matches;
+            }
+        }
+    }
+    const auto baseline_time = seconds_since(start);
+    std::printf("  One pass per pattern: %8.3f s, %9.1f MB/s, %zu matches\n", baseline_time, megabytes / baseline_time, baseline_matches);
+
+    bool all_matched{true};
+    for (const auto kernel : {MultiPatternMatcher::Kernel::Scalar, MultiPatternMatcher::Kernel::SSSE3, MultiPatternMatcher::Kernel::AVX2})
+    {
+        if (!MultiPatternMatcher::is_kernel_supported(kernel))
+        {
+            std::printf("  MultiPattern %-7s: not supported by this CPU\n", kernel_name(kernel));
+            continue;
+        }
+
+        MultiPatternMatcher matcher{};
+        for (size_t i = 0; i < patterns.size(); ++i)
+        {
+            matcher.add_pattern(patterns[i].bytes, patterns[i].mask, i);
+        }
+        matcher.compile(kernel);
+
+        size_t matches{};
+        start = std::chrono::steady_clock::now();
+        matcher.scan(buffer.data(), buffer.data() + buffer.size(), [&](size_t, const uint8_t*) {
+            ++matches;
+            return false;
+        });
+        const auto time = seconds_since(start);
+        std::printf("  MultiPattern %-7s: %8.3f s, %9.1f MB/s, %zu matches, %.1fx\n",
+                    kernel_name(kernel),
+                    time,
+                    megabytes / time,
+                    matches,
+                    baseline_time / time);
+        all_matched = all_matched && matches == baseline_matches;
+    }
+
+    if (!all_matched)
+    {
+        std::printf("Match counts differ from the one pass per pattern scan\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+#include <SigScanner/Common.hpp>
+
+namespace RC
+{
+    // Compiles any number of AOB patterns into a single matcher that finds all of them in one pass over a buffer.
+    // Candidates are found by testing the first byte of every pattern at once (SIMD when available),
+    // then filtered by a bitset of the first two bytes and a per-pattern anchor byte before the masked compare.
+    // This has no dependency on the OS so it can be used on any buffer, not just on committed module memory.
+    class MultiPatternMatcher
+    {
+      public:
+        // Return true to stop the scan entirely
+        using MatchCallback = std::function<bool(size_t pattern_id, const uint8_t* match_address)>;
+
+        enum class Kernel
+        {
+            Scalar,
+            SSSE3,
+            AVX2,
+        };
+
+        struct ParsedPattern
+        {
+            std::vector<uint8_t> bytes{};
+            // 0xFF for bytes that must match, 0x00 for wildcards, 0xF0 or 0x0F for half-byte wildcards
+            std::vector<uint8_t> mask{};
+        };
+
+      private:
+        struct CompiledPattern
+        {
+            std::vector<uint8_t> bytes{};
+            std::vector<uint8_t> mask{};
+            size_t id{};
+            // Offset & value of the last non-wildcard byte, checked before the full compare
+            size_t anchor_offset{};
+            uint8_t anchor_byte{};
+        };
+
+        std::vector<CompiledPattern> m_patterns{};
+        // Indexes into 'm_patterns' for every possible first byte
+        std::array<std::vector<uint32_t>, 256> m_buckets{};
+        // One bit for every (first byte, second byte) pair that at least one pattern can start with
+        std::vector<uint64_t> m_bigrams{};
+        // Nibble lookup tables used by the SIMD kernels to classify first bytes
+        alignas(32) std::array<uint8_t, 32> m_low_nibble_table{};
+        alignas(32) std::array<uint8_t, 32> m_high_nibble_table{};
+        size_t m_max_pattern_size{};
+        Kernel m_kernel{Kernel::Scalar};
+        bool m_is_compiled{};
+
+      public:
+        // Pattern format is the same as for the StdFind scan method, e.g. "48 8B ?? ?? E8".
+        // Throws if the pattern is empty or starts with a wildcard.
+        RC_SPSS_API auto add_pattern(std::string_view pattern, size_t id) -> void;
+        // 'mask' must be the same size as 'bytes', 0xFF for bytes that must match and 0x00 for wildcards.
+        RC_SPSS_API auto add_pattern(std::vector<uint8_t> bytes, std::vector<uint8_t> mask, size_t id) -> void;
+
+        // Must be called after all patterns have been added & before scanning.
+        // 'preferred_kernel' is downgraded if the CPU doesn't support it.
+        RC_SPSS_API auto compile(Kernel preferred_kernel = Kernel::AVX2) -> void;
+
+        // Reports every match whose bytes all lie within [begin, end).
+        RC_SPSS_API auto scan(const uint8_t* begin, const uint8_t* end, const MatchCallback& callback) const -> void;
+
+        [[nodiscard]] auto get_max_pattern_size() const -> size_t
+        {
+            return m_max_pattern_size;
+        }
+        [[nodiscard]] auto get_kernel() const -> Kernel
+        {
+            return m_kernel;
+        }
+        [[nodiscard]] auto get_num_patterns() const -> size_t
+        {
+            return m_patterns.size();
+        }
+
+        RC_SPSS_API static auto is_kernel_supported(Kernel kernel) -> bool;
+        // Converts a pattern like "48 8B ?? ?? E8" into bytes & a mask, throws on invalid characters.
+        RC_SPSS_API static auto parse_pattern(std::string_view pattern) -> ParsedPattern;
+
+      private:
+        auto is_bigram_candidate(const uint8_t* address) const -> bool
+        {
+            const size_t bigram = static_cast<size_t>(address[0]) << 8 | address[1];
+            return m_bigrams[bigram >> 6] & (uint64_t{1} << (bigram & 63));
+        }
+        // Returns true if the callback requested the scan to stop
+        auto verify_candidate(const uint8_t* address, const uint8_t* end, const MatchCallback& callback) const -> bool;
+        auto scan_scalar(const uint8_t* begin, const uint8_t* end, const MatchCallback& callback) const -> bool;
+        auto scan_ssse3(const uint8_t* begin, const uint8_t* end, const MatchCallback& callback) const -> bool;
+        auto scan_avx2(const uint8_t* begin, const uint8_t* end, const MatchCallback& callback) const -> bool;
+    };
+} // namespace RC
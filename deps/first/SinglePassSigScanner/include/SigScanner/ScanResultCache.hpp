@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <unordered_map>
+#include <vector>
+
+#include <SigScanner/Common.hpp>
+
+namespace RC
+{
+    struct SignatureData;
+
+    // On-disk record of where signatures were found in a specific build of a module.
+    // There's one file per module build, keyed by a hash of the PE headers & the .text section, so a game update simply results in a new file.
+    // The cache only stores locations, the scanner still re-checks the signature bytes at every cached address before using it.
+    // Cached matches are passed to 'on_match_found' in the order they were originally found, before the module is scanned.
+    // If the container doesn't accept any of them this time the module is scanned for it as normal, and the replayed matches aren't reported again,
+    // so 'on_match_found' is never called more than once for the same match, whether the cache is used or not.
+    class ScanResultCache
+    {
+      public:
+        struct CachedMatch
+        {
+            uint32_t index_into_signatures{};
+            uint32_t rva{};
+        };
+
+        // Containers that call 'on_match_found' more times than this before accepting a match aren't cached
+        constexpr static size_t max_matches_per_container = 16;
+
+      private:
+        std::filesystem::path m_file_path{};
+        uint8_t* m_module_base{};
+        size_t m_module_size{};
+        uint64_t m_module_hash{};
+        // Key is the hash of all signatures in a container
+        std::unordered_map<uint64_t, std::vector<CachedMatch>> m_entries{};
+        bool m_is_dirty{};
+
+      public:
+        // Loads the cache file for this module from 'cache_directory' if one exists
+        RC_SPSS_API ScanResultCache(const std::filesystem::path& cache_directory, void* module_base, size_t module_size);
+
+      public:
+        // Returns 0 if 'module_base' doesn't point to a valid PE image
+        // The hash is only calculated once per module base for the lifetime of the process
+        RC_SPSS_API static auto get_module_hash(void* module_base) -> uint64_t;
+        RC_SPSS_API static auto get_container_key(const std::vector<SignatureData>& signatures) -> uint64_t;
+
+        [[nodiscard]] auto is_valid() const -> bool
+        {
+            return m_module_hash != 0;
+        }
+        [[nodiscard]] auto get_module_base() const -> uint8_t*
+        {
+            return m_module_base;
+        }
+        [[nodiscard]] auto get_module_size() const -> size_t
+        {
+            return m_module_size;
+        }
+
+        RC_SPSS_API auto find(uint64_t container_key) const -> const std::vector<CachedMatch>*;
+        RC_SPSS_API auto store(uint64_t container_key, std::vector<CachedMatch> matches) -> void;
+        RC_SPSS_API auto erase(uint64_t container_key) -> void;
+
+        // Writes the cache to disk if anything changed since it was loaded
+        // Failing to write is not an error, the next launch will just scan normally
+        RC_SPSS_API auto save() -> void;
+    };
+} // namespace RC
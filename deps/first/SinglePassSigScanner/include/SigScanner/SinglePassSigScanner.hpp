@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <filesystem>
 #include <functional>
 #include <mutex>
 #include <vector>
@@ -18,6 +19,8 @@ typedef _MODULEINFO MODULEINFO;
 
 namespace RC
 {
+    class ScanResultCache;
+
     // Windows structs, to prevent the need to include Windows.h in this header
     struct WIN_MODULEINFO
     {
@@ -252,6 +255,13 @@ namespace RC
         // The scanner will set this to the size of the signature that was matched
         size_t match_signature_size{};
 
+        // Every match reported to 'on_match_found', in order, up to one past the limit of the scan result cache
+        std::vector<SignatureContainerLight> reported_matches{};
+
+        // Matches that were replayed from the scan result cache without the container accepting any of them
+        // 'on_match_found' has already been called for these, so the scan doesn't report them again
+        std::vector<SignatureContainerLight> replayed_matches{};
+
       public:
         template <typename OnMatchFound, typename OnScanFinished>
         SignatureContainer(std::vector<SignatureData> sig_param, OnMatchFound on_match_found_param, OnScanFinished on_scan_finished_param)
@@ -306,6 +316,8 @@ namespace RC
         {
             Scalar,
             StdFind,
+            // All signatures are compiled into one MultiPatternMatcher and found in a single SIMD pass
+            MultiPattern,
         };
 
       public:
@@ -316,10 +328,35 @@ namespace RC
         // Smaller modules might increase the cost of scanning due to the cost of creating threads
         RC_SPSS_API static uint32_t m_multithreading_module_size_threshold;
 
+        // Modules at or above the multi-threading threshold are split into units of this many bytes, which are shared out between all threads
+        // Small enough to stay in cache & to balance the work, large enough that picking the next unit is cheap
+        RC_SPSS_API static size_t m_work_unit_size;
+
+        // Directory for the persistent scan result cache, the cache is disabled if this is empty
+        RC_SPSS_API static std::filesystem::path m_scan_result_cache_directory;
+
       private:
         RC_SPSS_API auto static string_to_vector(std::string_view signature) -> std::vector<int>;
         RC_SPSS_API auto static string_to_vector(const std::vector<SignatureData>& signatures) -> std::vector<std::vector<int>>;
         RC_SPSS_API auto static format_aob_strings(std::vector<SignatureContainer>& signature_containers) -> void;
+        // Must be called with 'm_scanner_mutex' locked, returns true if the container is refusing more calls
+        RC_SPSS_API auto static report_match(SignatureContainer& signature_container, size_t signature_index, uint8_t* match_address, size_t signature_size)
+                -> bool;
+        // Replays cached matches through 'on_match_found' so that satisfied containers are skipped by the scan
+        RC_SPSS_API auto static apply_scan_result_cache(ScanResultCache& cache, std::vector<SignatureContainer>& signature_containers) -> void;
+        RC_SPSS_API auto static update_scan_result_cache(ScanResultCache& cache, const std::vector<SignatureContainer>& signature_containers) -> void;
+        RC_SPSS_API auto static are_all_containers_ignored(const std::vector<SignatureContainer>& signature_containers) -> bool;
+
+      public:
+        // Scans [start_address, end_address) but only reports matches that start before 'match_limit'
+        // The signatures are prepared once when the scanner is made, after that it can be called from any number of threads at once
+        using RangeScanner = std::function<void(uint8_t* start_address, uint8_t* match_limit, uint8_t* end_address)>;
+
+      private:
+        RC_SPSS_API auto static make_range_scanner(std::vector<SignatureContainer>& signature_containers) -> RangeScanner;
+        RC_SPSS_API auto static make_range_scanner_scalar(std::vector<SignatureContainer>& signature_containers) -> RangeScanner;
+        RC_SPSS_API auto static make_range_scanner_stdfind(std::vector<SignatureContainer>& signature_containers) -> RangeScanner;
+        RC_SPSS_API auto static make_range_scanner_multipattern(std::vector<SignatureContainer>& signature_containers) -> RangeScanner;
 
       public:
         RC_SPSS_API auto static scanner_work_thread(uint8_t* start_address,
@@ -334,6 +371,10 @@ namespace RC
                                                             uint8_t* end_address,
                                                             SYSTEM_INFO& info,
                                                             std::vector<SignatureContainer>& signature_containers) -> void;
+        RC_SPSS_API auto static scanner_work_thread_multipattern(uint8_t* start_address,
+                                                                 uint8_t* end_address,
+                                                                 SYSTEM_INFO& info,
+                                                                 std::vector<SignatureContainer>& signature_containers) -> void;
 
         using SignatureContainerMap = std::unordered_map<ScanTarget, std::vector<SignatureContainer>>;
         RC_SPSS_API auto static start_scan(SignatureContainerMap& signature_containers) -> void;
@@ -0,0 +1,349 @@
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <string>
+
+#include <SigScanner/MultiPatternMatcher.hpp>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define RC_SPSS_X64
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+// GCC & Clang refuse to inline intrinsics into functions that aren't compiled for the required instruction set.
+// MSVC doesn't need this, it allows any intrinsic in any function.
+#if defined(__GNUC__) || defined(__clang__)
+#define RC_SPSS_TARGET(target_name) __attribute__((target(target_name)))
+#else
+#define RC_SPSS_TARGET(target_name)
+#endif
+
+namespace RC
+{
+    static auto hex_char_to_nibble(char symbol) -> int
+    {
+        if (symbol >= '0' && symbol <= '9') return symbol - '0';
+        if (symbol >= 'A' && symbol <= 'F') return symbol - 'A' + 0xA;
+        if (symbol >= 'a' && symbol <= 'f') return symbol - 'a' + 0xA;
+        return -1;
+    }
+
+    auto MultiPatternMatcher::parse_pattern(std::string_view pattern) -> ParsedPattern
+    {
+        ParsedPattern parsed_pattern{};
+        auto& bytes = parsed_pattern.bytes;
+        auto& mask = parsed_pattern.mask;
+
+        for (size_t i = 0; i < pattern.length(); ++i)
+        {
+            const char symbol = pattern[i];
+            const char next_symbol = ((i + 1) < pattern.length()) ? pattern[i + 1] : ' ';
+            if (symbol == ' ')
+            {
+                continue;
+            }
+
+            // A single '?' or a '??' is a whole-byte wildcard
+            if (symbol == '?' && (next_symbol == '?' || next_symbol == ' '))
+            {
+                bytes.push_back(0x00);
+                mask.push_back(0x00);
+                ++i;
+                continue;
+            }
+
+            // Otherwise it's two nibbles, either of which may be a wildcard
+            const int high = symbol == '?' ? -1 : hex_char_to_nibble(symbol);
+            const int low = next_symbol == '?' ? -1 : hex_char_to_nibble(next_symbol);
+            if ((symbol != '?' && high == -1) || (next_symbol != '?' && low == -1))
+            {
+                throw std::runtime_error{std::string{"[MultiPatternMatcher::parse_pattern] Invalid character in pattern.\nPattern: "}.append(pattern)};
+            }
+
+            bytes.push_back(static_cast<uint8_t>((high == -1 ? 0 : high << 4) | (low == -1 ? 0 : low)));
+            mask.push_back(static_cast<uint8_t>((high == -1 ? 0x00 : 0xF0) | (low == -1 ? 0x00 : 0x0F)));
+            ++i;
+        }
+
+        return parsed_pattern;
+    }
+
+    auto MultiPatternMatcher::add_pattern(std::string_view pattern, size_t id) -> void
+    {
+        auto [bytes, mask] = parse_pattern(pattern);
+        add_pattern(std::move(bytes), std::move(mask), id);
+    }
+
+    auto MultiPatternMatcher::add_pattern(std::vector<uint8_t> bytes, std::vector<uint8_t> mask, size_t id) -> void
+    {
+        if (bytes.empty() || bytes.size() != mask.size())
+        {
+            throw std::runtime_error{"[MultiPatternMatcher::add_pattern] A pattern cannot be empty and must be the same size as its mask."};
+        }
+        if (mask[0] != 0xFF)
+        {
+            throw std::runtime_error{"[MultiPatternMatcher::add_pattern] A pattern cannot start with a wildcard."};
+        }
+
+        // Normalizing so that the masked compare can be done with a single '=='
+        for (size_t i = 0; i < bytes.size(); ++i)
+        {
+            bytes[i] &= mask[i];
+        }
+
+        auto& compiled_pattern = m_patterns.emplace_back(CompiledPattern{.bytes = std::move(bytes), .mask = std::move(mask), .id = id});
+        for (size_t i = compiled_pattern.bytes.size(); i-- > 1;)
+        {
+            if (compiled_pattern.mask[i] == 0xFF)
+            {
+                compiled_pattern.anchor_offset = i;
+                compiled_pattern.anchor_byte = compiled_pattern.bytes[i];
+                break;
+            }
+        }
+        if (compiled_pattern.anchor_offset == 0)
+        {
+            compiled_pattern.anchor_byte = compiled_pattern.bytes[0];
+        }
+
+        m_is_compiled = false;
+    }
+
+    auto MultiPatternMatcher::is_kernel_supported(Kernel kernel) -> bool
+    {
+        switch (kernel)
+        {
+        case Kernel::Scalar:
+            return true;
+#ifdef RC_SPSS_X64
+#ifdef _MSC_VER
+        case Kernel::SSSE3: {
+            int cpu_info[4]{};
+            __cpuid(cpu_info, 1);
+            return cpu_info[2] & (1 << 9);
+        }
+        case Kernel::AVX2: {
+            int cpu_info[4]{};
+            __cpuid(cpu_info, 1);
+            // The OS must have enabled saving of the YMM registers, otherwise AVX instructions will fault
+            const bool os_saves_ymm = (cpu_info[2] & (1 << 27)) && (cpu_info[2] & (1 << 28)) && (_xgetbv(0) & 0x6) == 0x6;
+            if (!os_saves_ymm)
+            {
+                return false;
+            }
+            __cpuidex(cpu_info, 7, 0);
+            return cpu_info[1] & (1 << 5);
+        }
+#else
+        case Kernel::SSSE3:
+            return __builtin_cpu_supports("ssse3");
+        case Kernel::AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+#endif
+        default:
+            return false;
+        }
+    }
+
+    auto MultiPatternMatcher::compile(Kernel preferred_kernel) -> void
+    {
+        m_buckets = {};
+        m_bigrams.assign((256 * 256) / 64, 0);
+        m_low_nibble_table = {};
+        m_high_nibble_table = {};
+        m_max_pattern_size = 0;
+
+        for (uint32_t pattern_index = 0; pattern_index < m_patterns.size(); ++pattern_index)
+        {
+            const auto& pattern = m_patterns[pattern_index];
+            const uint8_t first_byte = pattern.bytes[0];
+
+            m_buckets[first_byte].emplace_back(pattern_index);
+            m_max_pattern_size = std::max(m_max_pattern_size, pattern.bytes.size());
+
+            // Every second byte that this pattern accepts
+            for (size_t second_byte = 0; second_byte < 256; ++second_byte)
+            {
+                if (pattern.bytes.size() < 2 || (second_byte & pattern.mask[1]) == pattern.bytes[1])
+                {
+                    const size_t bigram = static_cast<size_t>(first_byte) << 8 | second_byte;
+                    m_bigrams[bigram >> 6] |= uint64_t{1} << (bigram & 63);
+                }
+            }
+
+            // Bytes are grouped into 8 classes by their high nibble, the SIMD kernels then test the low & high nibble tables against each other
+            // Bytes with the same high nibble never cause false positives, other collisions are removed by the bigram & bucket checks
+            const uint8_t byte_class = static_cast<uint8_t>(1 << ((first_byte >> 4) & 7));
+            m_low_nibble_table[first_byte & 0xF] |= byte_class;
+            m_high_nibble_table[first_byte >> 4] |= byte_class;
+        }
+
+        // The AVX2 shuffle works on two separate 128-bit lanes so the tables are duplicated into the upper lane
+        for (size_t i = 0; i < 16; ++i)
+        {
+            m_low_nibble_table[i + 16] = m_low_nibble_table[i];
+            m_high_nibble_table[i + 16] = m_high_nibble_table[i];
+        }
+
+        m_kernel = preferred_kernel;
+        while (m_kernel != Kernel::Scalar && !is_kernel_supported(m_kernel))
+        {
+            m_kernel = m_kernel == Kernel::AVX2 ? Kernel::SSSE3 : Kernel::Scalar;
+        }
+
+        m_is_compiled = true;
+    }
+
+    auto MultiPatternMatcher::verify_candidate(const uint8_t* address, const uint8_t* end, const MatchCallback& callback) const -> bool
+    {
+        const size_t bytes_available = static_cast<size_t>(end - address);
+        if (bytes_available >= 2 && !is_bigram_candidate(address))
+        {
+            return false;
+        }
+
+        for (const uint32_t pattern_index : m_buckets[*address])
+        {
+            const auto& pattern = m_patterns[pattern_index];
+            const size_t pattern_size = pattern.bytes.size();
+
+            if (pattern_size > bytes_available || address[pattern.anchor_offset] != pattern.anchor_byte)
+            {
+                continue;
+            }
+
+            bool found = true;
+            for (size_t pattern_offset = 1; pattern_offset < pattern_size; ++pattern_offset)
+            {
+                if ((address[pattern_offset] & pattern.mask[pattern_offset]) != pattern.bytes[pattern_offset])
+                {
+                    found = false;
+                    break;
+                }
+            }
+
+            if (found && callback(pattern.id, address))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    auto MultiPatternMatcher::scan_scalar(const uint8_t* begin, const uint8_t* end, const MatchCallback& callback) const -> bool
+    {
+        for (const uint8_t* address = begin; address < end; ++address)
+        {
+            if (!m_buckets[*address].empty() && verify_candidate(address, end, callback))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+#ifdef RC_SPSS_X64
+    RC_SPSS_TARGET("ssse3")
+    auto MultiPatternMatcher::scan_ssse3(const uint8_t* begin, const uint8_t* end, const MatchCallback& callback) const -> bool
+    {
+        const __m128i low_nibble_table = _mm_load_si128(reinterpret_cast<const __m128i*>(m_low_nibble_table.data()));
+        const __m128i high_nibble_table = _mm_load_si128(reinterpret_cast<const __m128i*>(m_high_nibble_table.data()));
+        const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+        const __m128i zero = _mm_setzero_si128();
+
+        const uint8_t* address = begin;
+        for (; end - address >= 16; address += 16)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(address));
+            const __m128i low_nibbles = _mm_and_si128(block, nibble_mask);
+            const __m128i high_nibbles = _mm_and_si128(_mm_srli_epi16(block, 4), nibble_mask);
+            const __m128i classes = _mm_and_si128(_mm_shuffle_epi8(low_nibble_table, low_nibbles), _mm_shuffle_epi8(high_nibble_table, high_nibbles));
+
+            uint32_t candidates = ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(classes, zero))) & 0xFFFF;
+            while (candidates)
+            {
+                if (verify_candidate(address + std::countr_zero(candidates), end, callback))
+                {
+                    return true;
+                }
+                candidates &= candidates - 1;
+            }
+        }
+
+        return scan_scalar(address, end, callback);
+    }
+
+    RC_SPSS_TARGET("avx2")
+    auto MultiPatternMatcher::scan_avx2(const uint8_t* begin, const uint8_t* end, const MatchCallback& callback) const -> bool
+    {
+        const __m256i low_nibble_table = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_low_nibble_table.data()));
+        const __m256i high_nibble_table = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_high_nibble_table.data()));
+        const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+        const __m256i zero = _mm256_setzero_si256();
+
+        const uint8_t* address = begin;
+        for (; end - address >= 32; address += 32)
+        {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(address));
+            const __m256i low_nibbles = _mm256_and_si256(block, nibble_mask);
+            const __m256i high_nibbles = _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble_mask);
+            const __m256i classes =
+                    _mm256_and_si256(_mm256_shuffle_epi8(low_nibble_table, low_nibbles), _mm256_shuffle_epi8(high_nibble_table, high_nibbles));
+
+            uint32_t candidates = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(classes, zero)));
+            while (candidates)
+            {
+                if (verify_candidate(address + std::countr_zero(candidates), end, callback))
+                {
+                    return true;
+                }
+                candidates &= candidates - 1;
+            }
+        }
+
+        return scan_scalar(address, end, callback);
+    }
+#else
+    auto MultiPatternMatcher::scan_ssse3(const uint8_t* begin, const uint8_t* end, const MatchCallback& callback) const -> bool
+    {
+        return scan_scalar(begin, end, callback);
+    }
+
+    auto MultiPatternMatcher::scan_avx2(const uint8_t* begin, const uint8_t* end, const MatchCallback& callback) const -> bool
+    {
+        return scan_scalar(begin, end, callback);
+    }
+#endif
+
+    auto MultiPatternMatcher::scan(const uint8_t* begin, const uint8_t* end, const MatchCallback& callback) const -> void
+    {
+        if (!m_is_compiled)
+        {
+            throw std::runtime_error{"[MultiPatternMatcher::scan] The matcher must be compiled before scanning."};
+        }
+        if (m_patterns.empty() || !begin || end <= begin)
+        {
+            return;
+        }
+
+        switch (m_kernel)
+        {
+        case Kernel::Scalar:
+            scan_scalar(begin, end, callback);
+            break;
+        case Kernel::SSSE3:
+            scan_ssse3(begin, end, callback);
+            break;
+        case Kernel::AVX2:
+            scan_avx2(begin, end, callback);
+            break;
+        }
+    }
+} // namespace RC
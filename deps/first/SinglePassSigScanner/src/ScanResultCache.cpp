@@ -0,0 +1,260 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+
+#define NOMINMAX
+#include <Windows.h>
+
+#include <fmt/core.h>
+#include <Profiler/Profiler.hpp>
+#include <SigScanner/ScanResultCache.hpp>
+#include <SigScanner/SinglePassSigScanner.hpp>
+
+namespace RC
+{
+    constexpr static char cache_file_magic[8] = {'U', 'E', '4', 'S', 'S', 'S', 'R', 'C'};
+    constexpr static uint32_t cache_file_version = 1;
+
+    static auto hash_bytes(const uint8_t* data, size_t size, uint64_t hash = 0xCBF29CE484222325) -> uint64_t
+    {
+        // Eight bytes at a time, the .text section of a large game can be well over 100MB
+        size_t offset = 0;
+        for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t))
+        {
+            uint64_t word{};
+            std::memcpy(&word, data + offset, sizeof(word));
+            hash = (hash ^ word) * 0x9E3779B97F4A7C15;
+            hash ^= hash >> 29;
+        }
+        for (; offset < size; ++offset)
+        {
+            hash = (hash ^ data[offset]) * 0x100000001B3;
+        }
+        return hash;
+    }
+
+    template <typename T>
+    static auto hash_value(const T& value, uint64_t hash) -> uint64_t
+    {
+        return hash_bytes(reinterpret_cast<const uint8_t*>(&value), sizeof(T), hash);
+    }
+
+    static auto calculate_module_hash(uint8_t* module_base) -> uint64_t
+    {
+        ProfilerScope();
+
+        const auto dos_header = reinterpret_cast<const IMAGE_DOS_HEADER*>(module_base);
+        if (dos_header->e_magic != IMAGE_DOS_SIGNATURE)
+        {
+            return 0;
+        }
+        const auto nt_headers = reinterpret_cast<const IMAGE_NT_HEADERS*>(module_base + dos_header->e_lfanew);
+        if (nt_headers->Signature != IMAGE_NT_SIGNATURE)
+        {
+            return 0;
+        }
+
+        // The whole header block can't be hashed because the loader rewrites 'ImageBase' when the module is relocated
+        uint64_t hash = hash_value(nt_headers->FileHeader, 0xCBF29CE484222325);
+        hash = hash_value(nt_headers->OptionalHeader.AddressOfEntryPoint, hash);
+        hash = hash_value(nt_headers->OptionalHeader.SizeOfCode, hash);
+        hash = hash_value(nt_headers->OptionalHeader.SizeOfImage, hash);
+        hash = hash_value(nt_headers->OptionalHeader.CheckSum, hash);
+
+        const auto* section = IMAGE_FIRST_SECTION(nt_headers);
+        for (WORD i = 0; i < nt_headers->FileHeader.NumberOfSections; ++i, ++section)
+        {
+            hash = hash_value(*section, hash);
+            if (std::memcmp(section->Name, ".text", sizeof(".text")) == 0)
+            {
+                hash = hash_bytes(module_base + section->VirtualAddress, section->Misc.VirtualSize, hash);
+            }
+        }
+
+        // Zero is reserved for invalid modules
+        return hash == 0 ? 1 : hash;
+    }
+
+    auto ScanResultCache::get_module_hash(void* module_base) -> uint64_t
+    {
+        static std::mutex module_hashes_mutex{};
+        static std::unordered_map<void*, uint64_t> module_hashes{};
+
+        if (!module_base)
+        {
+            return 0;
+        }
+
+        std::lock_guard<std::mutex> lock(module_hashes_mutex);
+        if (auto it = module_hashes.find(module_base); it != module_hashes.end())
+        {
+            return it->second;
+        }
+        return module_hashes.emplace(module_base, calculate_module_hash(static_cast<uint8_t*>(module_base))).first->second;
+    }
+
+    auto ScanResultCache::get_container_key(const std::vector<SignatureData>& signatures) -> uint64_t
+    {
+        uint64_t hash = hash_value(signatures.size(), 0xCBF29CE484222325);
+        for (const auto& signature_data : signatures)
+        {
+            hash = hash_value(signature_data.signature.size(), hash);
+            hash = hash_bytes(reinterpret_cast<const uint8_t*>(signature_data.signature.data()), signature_data.signature.size(), hash);
+        }
+        return hash;
+    }
+
+    template <typename T>
+    static auto read_value(std::ifstream& file, T& value) -> bool
+    {
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    template <typename T>
+    static auto write_value(std::ofstream& file, const T& value) -> void
+    {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    ScanResultCache::ScanResultCache(const std::filesystem::path& cache_directory, void* module_base, size_t module_size)
+        : m_module_base(static_cast<uint8_t*>(module_base)), m_module_size(module_size), m_module_hash(get_module_hash(module_base))
+    {
+        if (!is_valid())
+        {
+            return;
+        }
+
+        m_file_path = cache_directory / fmt::format("scan_results_{:016X}.bin", m_module_hash);
+
+        std::ifstream file{m_file_path, std::ios::binary};
+        if (!file)
+        {
+            return;
+        }
+
+        char magic[sizeof(cache_file_magic)]{};
+        uint32_t version{};
+        uint64_t module_hash{};
+        uint32_t num_entries{};
+        file.read(magic, sizeof(magic));
+        if (!file || std::memcmp(magic, cache_file_magic, sizeof(magic)) != 0 || !read_value(file, version) || version != cache_file_version ||
+            !read_value(file, module_hash) || module_hash != m_module_hash || !read_value(file, num_entries))
+        {
+            return;
+        }
+
+        // A truncated or otherwise damaged file only loses the entries that couldn't be read
+        // Every entry is verified by the scanner before being used so there's no need to be more careful than this
+        for (uint32_t entry_index = 0; entry_index < num_entries; ++entry_index)
+        {
+            uint64_t container_key{};
+            uint32_t num_matches{};
+            if (!read_value(file, container_key) || !read_value(file, num_matches) || num_matches == 0 || num_matches > max_matches_per_container)
+            {
+                break;
+            }
+
+            std::vector<CachedMatch> matches(num_matches);
+            bool read_all{true};
+            for (auto& match : matches)
+            {
+                if (!read_value(file, match.index_into_signatures) || !read_value(file, match.rva))
+                {
+                    read_all = false;
+                    break;
+                }
+            }
+            if (!read_all)
+            {
+                break;
+            }
+
+            m_entries.emplace(container_key, std::move(matches));
+        }
+    }
+
+    auto ScanResultCache::find(uint64_t container_key) const -> const std::vector<CachedMatch>*
+    {
+        auto it = m_entries.find(container_key);
+        return it == m_entries.end() ? nullptr : &it->second;
+    }
+
+    auto ScanResultCache::store(uint64_t container_key, std::vector<CachedMatch> matches) -> void
+    {
+        if (!is_valid() || matches.empty() || matches.size() > max_matches_per_container)
+        {
+            return;
+        }
+
+        auto [it, inserted] = m_entries.try_emplace(container_key);
+        if (inserted || it->second.size() != matches.size() ||
+            !std::equal(it->second.begin(), it->second.end(), matches.begin(), [](const CachedMatch& a, const CachedMatch& b) {
+                return a.index_into_signatures == b.index_into_signatures && a.rva == b.rva;
+            }))
+        {
+            it->second = std::move(matches);
+            m_is_dirty = true;
+        }
+    }
+
+    auto ScanResultCache::erase(uint64_t container_key) -> void
+    {
+        if (m_entries.erase(container_key))
+        {
+            m_is_dirty = true;
+        }
+    }
+
+    auto ScanResultCache::save() -> void
+    {
+        if (!is_valid() || !m_is_dirty)
+        {
+            return;
+        }
+
+        // Writing to a temporary file first so that another scan reading the cache never sees a half-written file
+        std::error_code ec{};
+        std::filesystem::create_directories(m_file_path.parent_path(), ec);
+        auto temp_file_path = m_file_path;
+        temp_file_path += fmt::format(".{}.tmp", GetCurrentThreadId());
+
+        {
+            std::ofstream file{temp_file_path, std::ios::binary | std::ios::trunc};
+            if (!file)
+            {
+                return;
+            }
+
+            file.write(cache_file_magic, sizeof(cache_file_magic));
+            write_value(file, cache_file_version);
+            write_value(file, m_module_hash);
+            write_value(file, static_cast<uint32_t>(m_entries.size()));
+            for (const auto& [container_key, matches] : m_entries)
+            {
+                write_value(file, container_key);
+                write_value(file, static_cast<uint32_t>(matches.size()));
+                for (const auto& match : matches)
+                {
+                    write_value(file, match.index_into_signatures);
+                    write_value(file, match.rva);
+                }
+            }
+
+            if (!file)
+            {
+                file.close();
+                std::filesystem::remove(temp_file_path, ec);
+                return;
+            }
+        }
+
+        std::filesystem::rename(temp_file_path, m_file_path, ec);
+        if (ec)
+        {
+            std::filesystem::remove(temp_file_path, ec);
+            return;
+        }
+        m_is_dirty = false;
+    }
+} // namespace RC
@@ -1,5 +1,10 @@
+#include <algorithm>
+#include <atomic>
 #include <format>
+#include <functional>
 #include <future>
+#include <memory>
+#include <optional>
 #include <regex>
 
 #define NOMINMAX
@@ -8,6 +13,8 @@
 
 #include <fmt/core.h>
 #include <Profiler/Profiler.hpp>
+#include <SigScanner/MultiPatternMatcher.hpp>
+#include <SigScanner/ScanResultCache.hpp>
 #include <SigScanner/SinglePassSigScanner.hpp>
 
 namespace RC
@@ -18,6 +25,8 @@ namespace RC
     uint32_t SinglePassScanner::m_num_threads = 8;
     SinglePassScanner::ScanMethod SinglePassScanner::m_scan_method = ScanMethod::Scalar;
     uint32_t SinglePassScanner::m_multithreading_module_size_threshold = 0x1000000;
+    size_t SinglePassScanner::m_work_unit_size = 0x80000;
+    std::filesystem::path SinglePassScanner::m_scan_result_cache_directory{};
     std::mutex SinglePassScanner::m_scanner_mutex{};
 
     auto WIN_MODULEINFO::operator=(MODULEINFO other) -> WIN_MODULEINFO&
@@ -486,6 +495,84 @@ namespace RC
         return pattern_data;
     }
 
+    auto SinglePassScanner::report_match(SignatureContainer& signature_container, size_t signature_index, uint8_t* match_address, size_t signature_size)
+            -> bool
+    {
+        if (!signature_container.replayed_matches.empty())
+        {
+            auto& replayed = signature_container.replayed_matches;
+            if (auto it = std::ranges::find_if(replayed,
+                                               [&](const SignatureContainerLight& match) {
+                                                   return match.index_into_signatures == signature_index && match.match_address == match_address;
+                                               });
+                it != replayed.end())
+            {
+                replayed.erase(it);
+                return signature_container.ignore;
+            }
+        }
+
+        // One of the signatures have found a full match so lets forward the details to the callable
+        signature_container.index_into_signatures = signature_index;
+        signature_container.match_address = match_address;
+        signature_container.match_signature_size = signature_size;
+
+        signature_container.ignore = signature_container.on_match_found(signature_container);
+
+        // Store results if the container at the containers request
+        if (signature_container.store_results)
+        {
+            signature_container.result_store.emplace_back(SignatureContainerLight{.index_into_signatures = signature_index, .match_address = match_address});
+        }
+
+        // Kept for the scan result cache, one past the limit so that the cache can tell that the limit was exceeded
+        if (signature_container.reported_matches.size() <= ScanResultCache::max_matches_per_container)
+        {
+            signature_container.reported_matches.emplace_back(
+                    SignatureContainerLight{.index_into_signatures = signature_index, .match_address = match_address});
+        }
+
+        return signature_container.ignore;
+    }
+
+    static auto is_scannable_region(const MEMORY_BASIC_INFORMATION& memory_info) -> bool
+    {
+        constexpr DWORD readable_flags = PAGE_READONLY | PAGE_READWRITE | PAGE_WRITECOPY | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY;
+        return (memory_info.State & MEM_COMMIT) && (memory_info.Protect & readable_flags) && !(memory_info.Protect & PAGE_GUARD);
+    }
+
+    // Calls 'callable' for every committed & readable region in [start_address, end_address), clamped to that range
+    template <typename Callable>
+    static auto for_each_scannable_region(uint8_t* start_address, uint8_t* end_address, Callable callable) -> void
+    {
+        MEMORY_BASIC_INFORMATION memory_info{};
+        for (uint8_t* i = start_address; i < end_address;)
+        {
+            if (!VirtualQuery(i, &memory_info, sizeof(memory_info)))
+            {
+                ++i;
+                continue;
+            }
+
+            uint8_t* region_start = static_cast<uint8_t*>(memory_info.BaseAddress);
+            uint8_t* region_end = region_start + memory_info.RegionSize;
+
+            if (is_scannable_region(memory_info))
+            {
+                callable((region_start > start_address) ? region_start : start_address, (region_end < end_address) ? region_end : end_address);
+            }
+
+            i = region_end;
+        }
+    }
+
+    auto SinglePassScanner::are_all_containers_ignored(const std::vector<SignatureContainer>& signature_containers) -> bool
+    {
+        return std::ranges::all_of(signature_containers, [](const SignatureContainer& signature_container) {
+            return signature_container.ignore;
+        });
+    }
+
     auto SinglePassScanner::scanner_work_thread(uint8_t* start_address,
                                                 uint8_t* end_address,
                                                 SYSTEM_INFO& info,
@@ -494,6 +581,12 @@ namespace RC
         ProfilerSetThreadName("UE4SS-ScannerWorkThread");
         ProfilerScope();
 
+        // Every container may already have been satisfied by the scan result cache
+        if (are_all_containers_ignored(signature_containers))
+        {
+            return;
+        }
+
         switch (m_scan_method)
         {
         case ScanMethod::Scalar:
@@ -502,165 +595,116 @@ namespace RC
         case ScanMethod::StdFind:
             scanner_work_thread_stdfind(start_address, end_address, info, signature_containers);
             break;
+        case ScanMethod::MultiPattern:
+            scanner_work_thread_multipattern(start_address, end_address, info, signature_containers);
+            break;
         }
     }
 
-    auto SinglePassScanner::scanner_work_thread_scalar(uint8_t* start_address,
-                                                       uint8_t* end_address,
-                                                       SYSTEM_INFO& info,
-                                                       std::vector<SignatureContainer>& signature_containers) -> void
+    auto SinglePassScanner::make_range_scanner(std::vector<SignatureContainer>& signature_containers) -> RangeScanner
     {
-        ProfilerScope();
-        if (!start_address)
-        {
-            start_address = static_cast<uint8_t*>(info.lpMinimumApplicationAddress);
-        }
-        if (!end_address)
+        switch (m_scan_method)
         {
-            end_address = static_cast<uint8_t*>(info.lpMaximumApplicationAddress);
+        case ScanMethod::StdFind:
+            return make_range_scanner_stdfind(signature_containers);
+        case ScanMethod::MultiPattern:
+            return make_range_scanner_multipattern(signature_containers);
+        case ScanMethod::Scalar:
+        default:
+            return make_range_scanner_scalar(signature_containers);
         }
+    }
 
-        MEMORY_BASIC_INFORMATION memory_info{};
-        DWORD protect_flags = PAGE_GUARD | PAGE_NOACCESS;
+    auto SinglePassScanner::make_range_scanner_scalar(std::vector<SignatureContainer>& signature_containers) -> RangeScanner
+    {
+        ProfilerScope();
 
         // TODO: Nasty nasty nasty. Come up with a better solution... wtf
         // It should ideally be able to work with the char* directly instead of converting to to vectors of ints
         // The reason why working directly with the char* is a problem is that it's expensive to convert a hex char to an int
-        // Also look at the comments below
-        std::vector<std::vector<std::vector<int>>> vector_of_sigs;
-
-        // const std::regex signature_validity_regex(R"(^([0-9A-F\?] )([0-9A-F\?]\/[0-9A-F\?] )*([0-9A-F\?])$)");
-
         // Making a vector here to be identical to the SignatureContainer vector
         // The difference is that it stores the sigs converted from char* to std::vector<int>
         // This makes it easier to work with even if it's wasteful
-        // This should not be done in the nested loops below because this operation is very slow
+        // This should not be done while scanning because this operation is very slow
+        std::vector<std::vector<std::vector<int>>> vector_of_sigs;
         vector_of_sigs.reserve(signature_containers.size());
         for (const auto& container : signature_containers)
         {
-            // Only continue if the signature is properly formatted
-            // Bring this code back when both:
-            // A. The regex has been updated to take into consideration.
-            // B. The threads have been synced before the scan to verify that all threads are scanning for valid signatures.
-            // for (const auto& signature_data : container.signatures)
-            //{
-            //    if (!std::regex_search(signature_data.signature, signature_validity_regex))
-            //    {
-            //        throw std::runtime_error{fmt::format("[SinglePassSigScanner::start_scan] A signature is improperly formatted. Signature: {}", signature_data.signature)};
-            //    }
-            //}
-
             // Signatures for this container
             vector_of_sigs.emplace_back(string_to_vector(container.signatures));
         }
 
-        // Loop everything
-        for (uint8_t* i = start_address; i < end_address;)
-        {
-            // Populate memory_info if VirtualQuery doesn't fail
-            if (VirtualQuery(i, &memory_info, sizeof(memory_info)))
+        return [&signature_containers, vector_of_sigs = std::move(vector_of_sigs)](uint8_t* start_address, uint8_t* match_limit, uint8_t* end_address) {
+            for (uint8_t* address = start_address; address < match_limit; ++address)
             {
-                // If the "protect flags" or state are undesired for this region then skip to the next iteration of the loop
-                if (memory_info.Protect & protect_flags || !(memory_info.State & MEM_COMMIT))
-                {
-                    i += memory_info.RegionSize;
-                    continue;
-                }
-
-                uint8_t* region_end = static_cast<uint8_t*>(memory_info.BaseAddress) + memory_info.RegionSize;
-
-                for (uint8_t* region_start = static_cast<uint8_t*>(memory_info.BaseAddress); region_start < region_end; ++region_start)
+                for (size_t container_index = 0; const auto& int_container : vector_of_sigs)
                 {
-                    if (region_start > end_address)
-                    {
-                        break;
-                    }
-
-                    bool skip_to_next_container{};
+                    auto& signature_container = signature_containers[container_index++];
 
-                    for (size_t container_index = 0; const auto& int_container : vector_of_sigs)
+                    for (size_t signature_index = 0; const auto& sig : int_container)
                     {
-                        for (size_t signature_index = 0; const auto& sig : int_container)
+                        // If the container is refusing more calls then skip to the next container
+                        if (signature_container.ignore)
                         {
-                            // If the container is refusing more calls then skip to the next container
-                            if (signature_containers[container_index].ignore)
-                            {
-                                break;
-                            }
+                            break;
+                        }
 
-                            // Skip if we're about to dereference uninitialized memory
-                            if (region_start >= end_address)
-                            {
-                                break;
-                            }
+                        // Skip if signature would extend past boundaries
+                        if (address + (sig.size() / 2) > end_address)
+                        {
+                            break;
+                        }
 
-                            // Skip if signature would extend past boundaries
-                            if (region_start + (sig.size() / 2) > region_end || region_start + (sig.size() / 2) > end_address)
+                        bool found = true;
+                        for (size_t sig_i = 0; sig_i < sig.size(); sig_i += 2)
+                        {
+                            if (sig[sig_i] != -1 && sig[sig_i] != HI_NIBBLE(*(address + (sig_i / 2))) ||
+                                sig[sig_i + 1] != -1 && sig[sig_i + 1] != LO_NIBBLE(*(address + (sig_i / 2))))
                             {
+                                found = false;
                                 break;
                             }
+                        }
 
-                            for (size_t sig_i = 0; sig_i < sig.size(); sig_i += 2)
-                            {
-                                if (sig.at(sig_i) != -1 && sig.at(sig_i) != HI_NIBBLE(*(byte*)(region_start + (sig_i / 2))) ||
-                                    sig.at(sig_i + 1) != -1 && sig.at(sig_i + 1) != LO_NIBBLE(*(byte*)(region_start + (sig_i / 2))))
-                                {
-                                    break;
-                                }
-
-                                if (sig_i + 2 == sig.size())
-                                {
-                                    {
-                                        std::lock_guard<std::mutex> safe_scope(m_scanner_mutex);
-
-                                        // Checking for the second time if the container is refusing more calls
-                                        // This is required when multi-threading is enabled
-                                        if (signature_containers[container_index].ignore)
-                                        {
-                                            skip_to_next_container = true;
-                                            break;
-                                        }
-
-                                        // One of the signatures have found a full match so lets forward the details to the callable
-                                        signature_containers[container_index].index_into_signatures = signature_index;
-                                        signature_containers[container_index].match_address = region_start;
-                                        signature_containers[container_index].match_signature_size = sig.size() / 2;
-
-                                        skip_to_next_container = signature_containers[container_index].on_match_found(signature_containers[container_index]);
-                                        signature_containers[container_index].ignore = skip_to_next_container;
-
-                                        // Store results if the container at the containers request
-                                        if (signature_containers[container_index].store_results)
-                                        {
-                                            signature_containers[container_index].result_store.emplace_back(
-                                                    SignatureContainerLight{.index_into_signatures = signature_index, .match_address = region_start});
-                                        }
-                                    }
-
-                                    break;
-                                }
-                            }
+                        if (found)
+                        {
+                            std::lock_guard<std::mutex> safe_scope(m_scanner_mutex);
 
-                            if (skip_to_next_container)
+                            // Checking for the second time if the container is refusing more calls
+                            // This is required when multi-threading is enabled
+                            if (signature_container.ignore || report_match(signature_container, signature_index, address, sig.size() / 2))
                             {
                                 // A match was found and signaled to skip to the next container
                                 break;
                             }
-
-                            ++signature_index;
                         }
 
-                        ++container_index;
+                        ++signature_index;
                     }
                 }
-
-                i = static_cast<uint8_t*>(memory_info.BaseAddress) + memory_info.RegionSize;
-            }
-            else
-            {
-                ++i;
             }
+        };
+    }
+
+    auto SinglePassScanner::scanner_work_thread_scalar(uint8_t* start_address,
+                                                       uint8_t* end_address,
+                                                       SYSTEM_INFO& info,
+                                                       std::vector<SignatureContainer>& signature_containers) -> void
+    {
+        ProfilerScope();
+        if (!start_address)
+        {
+            start_address = static_cast<uint8_t*>(info.lpMinimumApplicationAddress);
         }
+        if (!end_address)
+        {
+            end_address = static_cast<uint8_t*>(info.lpMaximumApplicationAddress);
+        }
+
+        const auto range_scanner = make_range_scanner_scalar(signature_containers);
+        for_each_scannable_region(start_address, end_address, [&](uint8_t* region_start, uint8_t* region_end) {
+            range_scanner(region_start, region_end, region_end);
+        });
     }
 
     static auto format_aob_string(std::string& str) -> void
@@ -695,58 +739,175 @@ namespace RC
         }
     }
 
-    auto SinglePassScanner::scanner_work_thread_stdfind(uint8_t* start_address,
-                                                        uint8_t* end_address,
-                                                        SYSTEM_INFO& info,
-                                                        std::vector<SignatureContainer>& signature_containers) -> void
+    // Keys must be the same no matter which scan method has formatted the signatures
+    static auto get_scan_result_cache_key(const std::vector<SignatureData>& signatures) -> uint64_t
     {
-        ProfilerScope();
+        auto formatted_signatures = signatures;
+        for (auto& signature_data : formatted_signatures)
+        {
+            format_aob_string(signature_data.signature);
+        }
+        return ScanResultCache::get_container_key(formatted_signatures);
+    }
 
-        if (!start_address)
+    // Returns the size of the signature if the cached match still matches the signature, otherwise 0
+    static auto verify_cached_match(const ScanResultCache& cache, const std::vector<SignatureData>& signatures, const ScanResultCache::CachedMatch& cached_match)
+            -> size_t
+    {
+        if (cached_match.index_into_signatures >= signatures.size())
         {
-            start_address = static_cast<uint8_t*>(info.lpMinimumApplicationAddress);
+            return 0;
         }
-        if (!end_address)
+
+        auto signature = signatures[cached_match.index_into_signatures].signature;
+        format_aob_string(signature);
+
+        MultiPatternMatcher::ParsedPattern pattern{};
+        try
         {
-            end_address = static_cast<uint8_t*>(info.lpMaximumApplicationAddress);
+            pattern = MultiPatternMatcher::parse_pattern(signature);
+        }
+        catch (std::exception&)
+        {
+            return 0;
         }
 
-        std::vector<std::vector<PatternData>> pattern_datas{};
-        for (auto& signature_container : signature_containers)
+        if (pattern.bytes.empty() || cached_match.rva + pattern.bytes.size() > cache.get_module_size())
         {
-            auto& pattern_data = pattern_datas.emplace_back();
-            for (auto& signature : signature_container.signatures)
+            return 0;
+        }
+
+        // Sections can be decommitted or re-protected at runtime so the memory has to be checked before it's read
+        uint8_t* match_address = cache.get_module_base() + cached_match.rva;
+        MEMORY_BASIC_INFORMATION memory_info{};
+        for (uint8_t* i = match_address; i < match_address + pattern.bytes.size();)
+        {
+            if (!VirtualQuery(i, &memory_info, sizeof(memory_info)) || !is_scannable_region(memory_info))
             {
-                pattern_data.emplace_back(make_mask(signature.signature, signature_container));
+                return 0;
             }
+            i = static_cast<uint8_t*>(memory_info.BaseAddress) + memory_info.RegionSize;
         }
 
-        MEMORY_BASIC_INFORMATION memory_info{};
-        DWORD readable_flags = PAGE_READONLY | PAGE_READWRITE | PAGE_WRITECOPY |
-                               PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY;
+        for (size_t pattern_offset = 0; pattern_offset < pattern.bytes.size(); ++pattern_offset)
+        {
+            if ((match_address[pattern_offset] & pattern.mask[pattern_offset]) != (pattern.bytes[pattern_offset] & pattern.mask[pattern_offset]))
+            {
+                return 0;
+            }
+        }
 
-        for (uint8_t* i = start_address; i < end_address;)
+        return pattern.bytes.size();
+    }
+
+    auto SinglePassScanner::apply_scan_result_cache(ScanResultCache& cache, std::vector<SignatureContainer>& signature_containers) -> void
+    {
+        ProfilerScope();
+
+        if (!cache.is_valid())
         {
-            if (!VirtualQuery(i, &memory_info, sizeof(memory_info)))
+            return;
+        }
+
+        for (auto& signature_container : signature_containers)
+        {
+            const auto container_key = get_scan_result_cache_key(signature_container.signatures);
+            const auto* cached_matches = cache.find(container_key);
+            if (!cached_matches)
             {
-                ++i;
                 continue;
             }
 
-            if (!(memory_info.Protect & readable_flags) || !(memory_info.State & MEM_COMMIT) || (memory_info.Protect & PAGE_GUARD))
+            // Every match has to be verified before any of them are reported, a partially valid entry is useless
+            std::vector<size_t> signature_sizes{};
+            for (const auto& cached_match : *cached_matches)
             {
-                i += memory_info.RegionSize;
+                const auto signature_size = verify_cached_match(cache, signature_container.signatures, cached_match);
+                if (signature_size == 0)
+                {
+                    signature_sizes.clear();
+                    break;
+                }
+                signature_sizes.emplace_back(signature_size);
+            }
+
+            if (signature_sizes.empty())
+            {
+                cache.erase(container_key);
                 continue;
             }
 
-            uint8_t* region_start = static_cast<uint8_t*>(memory_info.BaseAddress);
-            uint8_t* region_end = region_start + memory_info.RegionSize;
-            
-            auto scan_start = (region_start > start_address) ? region_start : start_address;
-            auto scan_end = (region_end < end_address) ? region_end : end_address;
-        
+            std::lock_guard<std::mutex> safe_scope(m_scanner_mutex);
+            for (size_t i = 0; i < cached_matches->size() && !signature_container.ignore; ++i)
+            {
+                const auto& cached_match = (*cached_matches)[i];
+                report_match(signature_container, cached_match.index_into_signatures, cache.get_module_base() + cached_match.rva, signature_sizes[i]);
+            }
+
+            // The container didn't accept the same matches this time so it gets a full scan instead
+            // The replayed matches stay reported, 'on_match_found' may have side effects so the scan must not call it for them a second time
+            if (!signature_container.ignore)
+            {
+                signature_container.replayed_matches = signature_container.reported_matches;
+            }
+        }
+    }
+
+    auto SinglePassScanner::update_scan_result_cache(ScanResultCache& cache, const std::vector<SignatureContainer>& signature_containers) -> void
+    {
+        if (!cache.is_valid())
+        {
+            return;
+        }
+
+        for (const auto& signature_container : signature_containers)
+        {
+            // Only containers that stopped the scan by accepting a match can be cached
+            // A container that wants every match has to be scanned every time
+            if (!signature_container.ignore || signature_container.reported_matches.empty() ||
+                signature_container.reported_matches.size() > ScanResultCache::max_matches_per_container)
+            {
+                continue;
+            }
+
+            std::vector<ScanResultCache::CachedMatch> cached_matches{};
+            for (const auto& reported_match : signature_container.reported_matches)
+            {
+                if (reported_match.match_address < cache.get_module_base() || reported_match.match_address >= cache.get_module_base() + cache.get_module_size())
+                {
+                    cached_matches.clear();
+                    break;
+                }
+                cached_matches.emplace_back(ScanResultCache::CachedMatch{
+                        .index_into_signatures = static_cast<uint32_t>(reported_match.index_into_signatures),
+                        .rva = static_cast<uint32_t>(reported_match.match_address - cache.get_module_base()),
+                });
+            }
+
+            if (!cached_matches.empty())
+            {
+                cache.store(get_scan_result_cache_key(signature_container.signatures), std::move(cached_matches));
+            }
+        }
+    }
+
+    auto SinglePassScanner::make_range_scanner_stdfind(std::vector<SignatureContainer>& signature_containers) -> RangeScanner
+    {
+        ProfilerScope();
+
+        std::vector<std::vector<PatternData>> pattern_datas{};
+        for (auto& signature_container : signature_containers)
+        {
+            auto& pattern_data = pattern_datas.emplace_back();
+            for (auto& signature : signature_container.signatures)
+            {
+                pattern_data.emplace_back(make_mask(signature.signature, signature_container));
+            }
+        }
+
+        return [pattern_datas = std::move(pattern_datas)](uint8_t* start_address, uint8_t* match_limit, uint8_t* end_address) {
             // Loop everything
-            for (size_t container_index = 0; const auto& patterns : pattern_datas)
+            for (const auto& patterns : pattern_datas)
             {
                 for (size_t signature_index = 0; const auto& pattern_data : patterns)
                 {
@@ -756,12 +917,17 @@ namespace RC
                         break;
                     }
 
-                    auto it = scan_start;
-                    if (static_cast<size_t>(scan_end - scan_start) < pattern_data.pattern.size())
+                    if (static_cast<size_t>(end_address - start_address) < pattern_data.pattern.size())
                     {
+                        ++signature_index;
                         continue; // Skip if pattern is larger than region
                     }
-                    auto end = scan_end - pattern_data.pattern.size() + 1;
+                    auto it = start_address;
+                    auto end = end_address - pattern_data.pattern.size() + 1;
+                    if (end > match_limit)
+                    {
+                        end = match_limit;
+                    }
                     uint8_t needle = pattern_data.pattern[0];
 
                     bool skip_to_next_container{};
@@ -779,31 +945,15 @@ namespace RC
 
                         if (found)
                         {
+                            std::lock_guard<std::mutex> safe_scope(m_scanner_mutex);
+
+                            // Checking for the second time if the container is refusing more calls
+                            // This is required when multi-threading is enabled
+                            if (pattern_data.signature_container->ignore ||
+                                report_match(*pattern_data.signature_container, signature_index, it, pattern_data.pattern.size()))
                             {
-                                std::lock_guard<std::mutex> safe_scope(m_scanner_mutex);
-
-                                // Checking for the second time if the container is refusing more calls
-                                // This is required when multi-threading is enabled
-                                if (pattern_data.signature_container->ignore)
-                                {
-                                    skip_to_next_container = true;
-                                    break;
-                                }
-
-                                // One of the signatures have found a full match so lets forward the details to the callable
-                                pattern_data.signature_container->index_into_signatures = signature_index;
-                                pattern_data.signature_container->match_address = it;
-                                pattern_data.signature_container->match_signature_size = pattern_data.pattern.size();
-
-                                skip_to_next_container = pattern_data.signature_container->on_match_found(*pattern_data.signature_container);
-                                pattern_data.signature_container->ignore = skip_to_next_container;
-
-                                // Store results if the container at the containers request
-                                if (pattern_data.signature_container->store_results)
-                                {
-                                    pattern_data.signature_container->result_store.emplace_back(
-                                            SignatureContainerLight{.index_into_signatures = signature_index, .match_address = it});
-                                }
+                                skip_to_next_container = true;
+                                break;
                             }
                         }
 
@@ -818,25 +968,145 @@ namespace RC
 
                     ++signature_index;
                 }
-                ++container_index;
             }
-            i = region_end;
+        };
+    }
+
+    auto SinglePassScanner::scanner_work_thread_stdfind(uint8_t* start_address,
+                                                        uint8_t* end_address,
+                                                        SYSTEM_INFO& info,
+                                                        std::vector<SignatureContainer>& signature_containers) -> void
+    {
+        ProfilerScope();
+
+        if (!start_address)
+        {
+            start_address = static_cast<uint8_t*>(info.lpMinimumApplicationAddress);
+        }
+        if (!end_address)
+        {
+            end_address = static_cast<uint8_t*>(info.lpMaximumApplicationAddress);
+        }
+
+        const auto range_scanner = make_range_scanner_stdfind(signature_containers);
+        for_each_scannable_region(start_address, end_address, [&](uint8_t* region_start, uint8_t* region_end) {
+            range_scanner(region_start, region_end, region_end);
+        });
+    }
+
+    auto SinglePassScanner::make_range_scanner_multipattern(std::vector<SignatureContainer>& signature_containers) -> RangeScanner
+    {
+        ProfilerScope();
+
+        // Pattern ids are indexes into this vector
+        struct PatternOwner
+        {
+            SignatureContainer* signature_container;
+            size_t signature_index;
+            size_t signature_size;
+        };
+        std::vector<PatternOwner> pattern_owners{};
+
+        // Shared because the matcher is large & the returned scanner must be copyable
+        auto matcher = std::make_shared<MultiPatternMatcher>();
+        for (auto& signature_container : signature_containers)
+        {
+            for (size_t signature_index = 0; const auto& signature : signature_container.signatures)
+            {
+                auto pattern_data = make_mask(signature.signature, signature_container);
+                const auto signature_size = pattern_data.pattern.size();
+                matcher->add_pattern(std::move(pattern_data.pattern), std::move(pattern_data.mask), pattern_owners.size());
+                pattern_owners.emplace_back(PatternOwner{&signature_container, signature_index, signature_size});
+                ++signature_index;
+            }
+        }
+        matcher->compile();
+
+        return [&signature_containers, matcher = std::move(matcher), pattern_owners = std::move(pattern_owners)](uint8_t* start_address,
+                                                                                                                 uint8_t* match_limit,
+                                                                                                                 uint8_t* end_address) {
+            matcher->scan(start_address, end_address, [&](size_t pattern_id, const uint8_t* match_address) -> bool {
+                // Matches past the limit belong to the next work unit
+                if (match_address >= match_limit)
+                {
+                    return true;
+                }
+
+                auto& owner = pattern_owners[pattern_id];
+                auto& signature_container = *owner.signature_container;
+
+                std::lock_guard<std::mutex> safe_scope(m_scanner_mutex);
+
+                // The container is refusing more calls, either from an earlier match in this thread or from another thread
+                if (signature_container.ignore)
+                {
+                    return false;
+                }
+
+                report_match(signature_container, owner.signature_index, const_cast<uint8_t*>(match_address), owner.signature_size);
+
+                // There's no point scanning further once every container is refusing calls
+                return are_all_containers_ignored(signature_containers);
+            });
+        };
+    }
+
+    auto SinglePassScanner::scanner_work_thread_multipattern(uint8_t* start_address,
+                                                             uint8_t* end_address,
+                                                             SYSTEM_INFO& info,
+                                                             std::vector<SignatureContainer>& signature_containers) -> void
+    {
+        ProfilerScope();
+
+        if (!start_address)
+        {
+            start_address = static_cast<uint8_t*>(info.lpMinimumApplicationAddress);
         }
+        if (!end_address)
+        {
+            end_address = static_cast<uint8_t*>(info.lpMaximumApplicationAddress);
+        }
+
+        const auto range_scanner = make_range_scanner_multipattern(signature_containers);
+        for_each_scannable_region(start_address, end_address, [&](uint8_t* region_start, uint8_t* region_end) {
+            range_scanner(region_start, region_end, region_end);
+        });
     }
 
+    // All containers that are scanned for in one module
+    struct ScanJob
+    {
+        std::vector<SignatureContainer>* signature_containers{};
+        uint8_t* module_start_address{};
+        uint8_t* module_end_address{};
+        SinglePassScanner::RangeScanner range_scanner{};
+        std::optional<ScanResultCache> scan_result_cache{};
+    };
+
+    struct ScanWorkUnit
+    {
+        size_t job_index{};
+        uint8_t* start_address{};
+        // Only matches that start before this address are reported, the bytes after it are only there for matches that cross into the next unit
+        uint8_t* match_limit{};
+        uint8_t* end_address{};
+        // Modules below the multi-threading threshold are scanned as one unit, in address order, like they were before work units existed
+        bool is_whole_module{};
+    };
+
     auto SinglePassScanner::start_scan(SignatureContainerMap& signature_containers) -> void
     {
-        SYSTEM_INFO info{};
-        GetSystemInfo(&info);
+        ProfilerScope();
 
         // If not modular then the containers get merged into one scan target
         // That way there are no extra scans
-        // If modular then loop the containers and retrieve the scan target for each and pass everything to the do_scan() lambda
+        // If modular then every scan target becomes its own job, and all jobs share the same pool of threads
+        std::vector<SignatureContainer> merged_containers;
+        std::vector<ScanJob> jobs{};
 
         if (!SigScannerStaticData::m_is_modular)
         {
             MODULEINFO merged_module_info{};
-            std::vector<SignatureContainer> merged_containers;
 
             for (const auto& [scan_target, outer_container] : signature_containers)
             {
@@ -854,75 +1124,164 @@ namespace RC
                 return;
             }
 
-            if (m_scan_method == ScanMethod::StdFind)
+            uint8_t* module_start_address = static_cast<uint8_t*>(merged_module_info.lpBaseOfDll);
+            jobs.emplace_back(ScanJob{
+                    .signature_containers = &merged_containers,
+                    .module_start_address = module_start_address,
+                    .module_end_address = module_start_address + merged_module_info.SizeOfImage,
+            });
+        }
+        else
+        {
+            for (auto& [scan_target, signature_container] : signature_containers)
             {
-                format_aob_strings(merged_containers);
+                if (signature_container.empty())
+                {
+                    continue;
+                }
+
+                uint8_t* module_start_address = static_cast<uint8_t*>(SigScannerStaticData::m_modules_info[scan_target].lpBaseOfDll);
+                jobs.emplace_back(ScanJob{
+                        .signature_containers = &signature_container,
+                        .module_start_address = module_start_address,
+                        .module_end_address = module_start_address + SigScannerStaticData::m_modules_info[scan_target].SizeOfImage,
+                });
             }
+        }
 
-            uint8_t* module_start_address = static_cast<uint8_t*>(merged_module_info.lpBaseOfDll);
+        std::vector<ScanWorkUnit> work_units{};
+        for (size_t job_index = 0; job_index < jobs.size(); ++job_index)
+        {
+            auto& job = jobs[job_index];
+            auto& job_containers = *job.signature_containers;
+
+            if (m_scan_method == ScanMethod::StdFind || m_scan_method == ScanMethod::MultiPattern)
+            {
+                format_aob_strings(job_containers);
+            }
 
-            if (merged_module_info.SizeOfImage >= m_multithreading_module_size_threshold)
+            if (!m_scan_result_cache_directory.empty())
             {
-                // Module is large enough to make it overall faster to scan with multiple threads
-                std::vector<std::future<void>> scan_threads;
+                job.scan_result_cache.emplace(m_scan_result_cache_directory,
+                                              job.module_start_address,
+                                              static_cast<size_t>(job.module_end_address - job.module_start_address));
+                apply_scan_result_cache(*job.scan_result_cache, job_containers);
+            }
+
+            if (are_all_containers_ignored(job_containers))
+            {
+                continue;
+            }
+
+            job.range_scanner = make_range_scanner(job_containers);
+
+            const size_t module_size = static_cast<size_t>(job.module_end_address - job.module_start_address);
+            if (module_size < m_multithreading_module_size_threshold)
+            {
+                // Module is too small to make it overall faster to split it between multiple threads
+                work_units.emplace_back(ScanWorkUnit{
+                        .job_index = job_index,
+                        .start_address = job.module_start_address,
+                        .match_limit = job.module_end_address,
+                        .end_address = job.module_end_address,
+                        .is_whole_module = true,
+                });
+                continue;
+            }
+
+            // The string length of a signature is always at least the number of bytes it matches
+            size_t overlap{};
+            for (const auto& signature_container : job_containers)
+            {
+                for (const auto& signature_data : signature_container.signatures)
+                {
+                    overlap = std::max(overlap, signature_data.signature.size());
+                }
+            }
+
+            for_each_scannable_region(job.module_start_address, job.module_end_address, [&](uint8_t* region_start, uint8_t* region_end) {
+                for (uint8_t* unit_start = region_start; unit_start < region_end; unit_start += m_work_unit_size)
+                {
+                    uint8_t* match_limit = (static_cast<size_t>(region_end - unit_start) > m_work_unit_size) ? unit_start + m_work_unit_size : region_end;
+                    uint8_t* unit_end = (static_cast<size_t>(region_end - match_limit) > overlap) ? match_limit + overlap : region_end;
+                    work_units.emplace_back(ScanWorkUnit{
+                            .job_index = job_index,
+                            .start_address = unit_start,
+                            .match_limit = match_limit,
+                            .end_address = unit_end,
+                    });
+                }
+            });
+        }
+
+        // Largest units first so that no thread is left with a large module at the end while the others are idle
+        std::ranges::stable_sort(work_units, std::ranges::greater{}, [](const ScanWorkUnit& work_unit) {
+            return work_unit.end_address - work_unit.start_address;
+        });
+
+        // Threads pull the next unit as soon as they're done with their current one
+        std::atomic<size_t> next_work_unit{};
+        const auto work_thread = [&]() {
+            ProfilerSetThreadName("UE4SS-ScannerWorkThread");
+            ProfilerScope();
 
-                // Higher values are better for debugging
-                // You will get a bigger diminishing returns the faster your computer is (especially in release mode)
-                uint32_t range = merged_module_info.SizeOfImage / m_num_threads;
+            for (size_t work_unit_index = next_work_unit++; work_unit_index < work_units.size(); work_unit_index = next_work_unit++)
+            {
+                const auto& work_unit = work_units[work_unit_index];
+                const auto& job = jobs[work_unit.job_index];
 
-                // Calculating the ranges for each thread to scan and starting the scan
-                uint32_t last_range{};
-                for (uint32_t thread_id = 0; thread_id < m_num_threads; ++thread_id)
                 {
-                    scan_threads.emplace_back(std::async(std::launch::async,
-                                                         &scanner_work_thread,
-                                                         module_start_address + last_range,
-                                                         module_start_address + last_range + range,
-                                                         std::ref(info),
-                                                         std::ref(merged_containers)));
-
-                    last_range += range;
+                    // Every container in this job has already accepted a match, possibly in another thread
+                    std::lock_guard<std::mutex> safe_scope(m_scanner_mutex);
+                    if (are_all_containers_ignored(*job.signature_containers))
+                    {
+                        continue;
+                    }
                 }
 
-                for (const auto& scan_thread : scan_threads)
+                if (work_unit.is_whole_module)
                 {
-                    scan_thread.wait();
+                    for_each_scannable_region(work_unit.start_address, work_unit.end_address, [&](uint8_t* region_start, uint8_t* region_end) {
+                        job.range_scanner(region_start, region_end, region_end);
+                    });
+                }
+                else
+                {
+                    job.range_scanner(work_unit.start_address, work_unit.match_limit, work_unit.end_address);
                 }
             }
-            else
+        };
+
+        if (!work_units.empty())
+        {
+            // The calling thread is one of the workers
+            const size_t num_threads = std::clamp<size_t>(m_num_threads, 1, work_units.size());
+            std::vector<std::future<void>> scan_threads;
+            for (size_t thread_id = 1; thread_id < num_threads; ++thread_id)
             {
-                // Module is too small to make it overall faster to scan with multiple threads
-                uint8_t* module_end_address = static_cast<uint8_t*>(module_start_address + merged_module_info.SizeOfImage);
-                scanner_work_thread(module_start_address, module_end_address, info, merged_containers);
+                scan_threads.emplace_back(std::async(std::launch::async, work_thread));
             }
 
-            for (auto& container : merged_containers)
+            work_thread();
+
+            for (const auto& scan_thread : scan_threads)
             {
-                container.on_scan_finished(container);
+                scan_thread.wait();
             }
         }
-        else
+
+        for (auto& job : jobs)
         {
-            // This ranged for loop is performing a copy of unordered_map<ScanTarget, vector<SignatureContainer>>
-            // Is this required ? Would it be worth trying to avoid copying here ?
-            // Right now it can't be auto& or const auto& because the do_scan function takes a non-const since it needs to mutate the values inside the vector
-            for (auto& [scan_target, signature_container] : signature_containers)
+            if (job.scan_result_cache)
             {
-                if (m_scan_method == ScanMethod::StdFind)
-                {
-                    format_aob_strings(signature_container);
-                }
-                
-                uint8_t* module_start_address = static_cast<uint8_t*>(SigScannerStaticData::m_modules_info[scan_target].lpBaseOfDll);
-                uint8_t* module_end_address = static_cast<uint8_t*>(module_start_address + SigScannerStaticData::m_modules_info[scan_target].SizeOfImage);
-
-                scanner_work_thread(module_start_address, module_end_address, info, signature_container);
+                update_scan_result_cache(*job.scan_result_cache, *job.signature_containers);
+                job.scan_result_cache->save();
+            }
 
-                for (auto& container : signature_container)
-                {
-                    container.on_scan_finished(container);
-                }
+            for (auto& container : *job.signature_containers)
+            {
+                container.on_scan_finished(container);
             }
         }
     }
-} // namespace RC
\ No newline at end of file
+} // namespace RC
@@ -0,0 +1,281 @@
+// Checks every MultiPatternMatcher kernel that the CPU supports against a plain masked compare at every offset.
+// Built when UE4SS_SinglePassSigScanner_BUILD_TESTS is on, and run with ctest.
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <SigScanner/MultiPatternMatcher.hpp>
+
+using namespace RC;
+
+using Kernel = MultiPatternMatcher::Kernel;
+// Pattern id & offset from the start of the buffer
+using Matches = std::vector<std::pair<size_t, size_t>>;
+
+struct TestPattern
+{
+    std::vector<uint8_t> bytes{};
+    std::vector<uint8_t> mask{};
+};
+
+static auto kernel_name(Kernel kernel) -> const char*
+{
+    switch (kernel)
+    {
+    case Kernel::Scalar:
+        return "Scalar";
+    case Kernel::SSSE3:
+        return "SSSE3";
+    case Kernel::AVX2:
+        return "AVX2";
+    }
+    return "Unknown";
+}
+
+static auto supported_kernels() -> std::vector<Kernel>
+{
+    std::vector<Kernel> kernels{};
+    for (const auto kernel : {Kernel::Scalar, Kernel::SSSE3, Kernel::AVX2})
+    {
+        if (MultiPatternMatcher::is_kernel_supported(kernel))
+        {
+            kernels.emplace_back(kernel);
+        }
+    }
+    return kernels;
+}
+
+// What the StdFind scan method does, one masked compare per pattern at every offset
+static auto reference_scan(const std::vector<TestPattern>& patterns, const uint8_t* begin, const uint8_t* end) -> Matches
+{
+    Matches matches{};
+    for (size_t id = 0; id < patterns.size(); ++id)
+    {
+        const auto& pattern = patterns[id];
+        for (const uint8_t* address = begin; address + pattern.bytes.size() <= end; ++address)
+        {
+            bool found{true};
+            for (size_t i = 0; i < pattern.bytes.size() && found; ++i)
+            {
+                found = (address[i] & pattern.mask[i]) == (pattern.bytes[i] & pattern.mask[i]);
+            }
+            if (found)
+            {
+                matches.emplace_back(id, static_cast<size_t>(address - begin));
+            }
+        }
+    }
+    std::sort(matches.begin(), matches.end());
+    return matches;
+}
+
+static auto matcher_scan(const std::vector<TestPattern>& patterns, Kernel kernel, const uint8_t* begin, const uint8_t* end) -> Matches
+{
+    MultiPatternMatcher matcher{};
+    for (size_t id = 0; id < patterns.size(); ++id)
+    {
+        matcher.add_pattern(patterns[id].bytes, patterns[id].mask, id);
+    }
+    matcher.compile(kernel);
+
+    Matches matches{};
+    matcher.scan(begin, end, [&](size_t id, const uint8_t* address) {
+        matches.emplace_back(id, static_cast<size_t>(address - begin));
+        return false;
+    });
+    std::sort(matches.begin(), matches.end());
+    return matches;
+}
+
+static auto parse(std::string_view pattern) -> TestPattern
+{
+    auto [bytes, mask] = MultiPatternMatcher::parse_pattern(pattern);
+    return TestPattern{std::move(bytes), std::move(mask)};
+}
+
+static auto check(const char* name, const std::vector<TestPattern>& patterns, const std::vector<uint8_t>& buffer, size_t begin_offset, size_t end_offset)
+        -> bool
+{
+    const auto* begin = buffer.data() + begin_offset;
+    const auto* end = buffer.data() + end_offset;
+    const auto expected = reference_scan(patterns, begin, end);
+
+    bool passed{true};
+    for (const auto kernel : supported_kernels())
+    {
+        if (matcher_scan(patterns, kernel, begin, end) != expected)
+        {
+            std::printf("FAIL %s (%s): matches differ from the reference scan\n", name, kernel_name(kernel));
+            passed = false;
+        }
+    }
+    if (passed)
+    {
+        std::printf("ok   %s: %zu matches\n", name, expected.size());
+    }
+    return passed;
+}
+
+static auto check_expected(const char* name, const std::vector<TestPattern>& patterns, const std::vector<uint8_t>& buffer, const Matches& expected) -> bool
+{
+    if (reference_scan(patterns, buffer.data(), buffer.data() + buffer.size()) != expected)
+    {
+        std::printf("FAIL %s: the test's expected matches are wrong\n", name);
+        return false;
+    }
+    return check(name, patterns, buffer, 0, buffer.size());
+}
+
+static auto test_wildcards() -> bool
+{
+    const std::vector<TestPattern> patterns{parse("48 8B ?? ?? E8"), parse("48 ?B 05"), parse("C3 ? 9?")};
+    const std::vector<uint8_t> buffer{0x48, 0x8B, 0x12, 0x34, 0xE8, 0x00, 0x48, 0x3B, 0x05, 0xC3, 0xCC, 0x9F, 0x48, 0x8B, 0x05, 0x00, 0xE9};
+    return check_expected("wildcards", patterns, buffer, {{0, 0}, {1, 6}, {1, 12}, {2, 9}});
+}
+
+static auto test_overlapping_patterns() -> bool
+{
+    // A pattern that overlaps itself, a pattern that's a prefix of another, and the same pattern twice
+    const std::vector<TestPattern> patterns{parse("AA AA"), parse("48 8B"), parse("48 8B 05"), parse("48 8B")};
+    const std::vector<uint8_t> buffer{0xAA, 0xAA, 0xAA, 0x48, 0x8B, 0x05, 0xAA};
+    return check_expected("overlapping patterns", patterns, buffer, {{0, 0}, {0, 1}, {1, 3}, {2, 3}, {3, 3}});
+}
+
+static auto test_region_boundaries() -> bool
+{
+    const std::vector<TestPattern> patterns{parse("11 22 33"), parse("44 ?? 66")};
+    std::vector<uint8_t> buffer(96, 0x90);
+
+    bool passed{true};
+    // Matches that start at the first byte & end at the last byte, and the same match cut off by the end of a region
+    for (const auto offset : {size_t{0}, buffer.size() - 3})
+    {
+        std::copy_n(std::begin({uint8_t{0x11}, uint8_t{0x22}, uint8_t{0x33}}), 3, buffer.begin() + offset);
+    }
+    passed &= check("matches at the ends of the buffer", patterns, buffer, 0, buffer.size());
+    passed &= check("match cut off by the end of the region", patterns, buffer, 0, buffer.size() - 1);
+
+    // Matches that straddle every 16 & 32 byte block boundary that the SIMD kernels load
+    std::fill(buffer.begin(), buffer.end(), uint8_t{0x90});
+    for (const auto offset : {size_t{14}, size_t{30}, size_t{47}, size_t{62}, size_t{79}})
+    {
+        buffer[offset] = 0x44;
+        buffer[offset + 2] = 0x66;
+    }
+    passed &= check("matches across SIMD blocks", patterns, buffer, 0, buffer.size());
+
+    // A region that starts or ends inside a match must not report it
+    passed &= check("region that cuts matches off", patterns, buffer, 15, 81);
+    passed &= check("region shorter than a SIMD block", patterns, buffer, 29, 40);
+    return passed;
+}
+
+static auto test_random_buffers() -> bool
+{
+    std::mt19937 rng{1337};
+    // Few distinct bytes so that patterns match often
+    const auto random_byte = [&] {
+        return static_cast<uint8_t>(std::uniform_int_distribution<int>{0, 3}(rng) * 0x11);
+    };
+
+    bool passed{true};
+    for (int round = 0; round < 200 && passed; ++round)
+    {
+        std::vector<TestPattern> patterns(std::uniform_int_distribution<size_t>{1, 12}(rng));
+        for (auto& pattern : patterns)
+        {
+            const auto size = std::uniform_int_distribution<size_t>{1, 6}(rng);
+            for (size_t i = 0; i < size; ++i)
+            {
+                const auto wildcard = i == 0 ? 0 : std::uniform_int_distribution<int>{0, 5}(rng);
+                pattern.bytes.emplace_back(random_byte());
+                pattern.mask.emplace_back(wildcard == 0 ? 0xFF : wildcard == 1 ? 0x00 : wildcard == 2 ? 0xF0 : wildcard == 3 ? 0x0F : 0xFF);
+            }
+        }
+
+        std::vector<uint8_t> buffer(std::uniform_int_distribution<size_t>{1, 300}(rng));
+        std::generate(buffer.begin(), buffer.end(), random_byte);
+        const auto begin_offset = std::uniform_int_distribution<size_t>{0, buffer.size() - 1}(rng);
+        const auto end_offset = std::uniform_int_distribution<size_t>{begin_offset, buffer.size()}(rng);
+
+        const auto expected = reference_scan(patterns, buffer.data() + begin_offset, buffer.data() + end_offset);
+        for (const auto kernel : supported_kernels())
+        {
+            if (matcher_scan(patterns, kernel, buffer.data() + begin_offset, buffer.data() + end_offset) != expected)
+            {
+                std::printf("FAIL random buffers (%s): round %d differs from the reference scan\n", kernel_name(kernel), round);
+                passed = false;
+            }
+        }
+    }
+    if (passed)
+    {
+        std::printf("ok   random buffers\n");
+    }
+    return passed;
+}
+
+static auto test_stop() -> bool
+{
+    MultiPatternMatcher matcher{};
+    matcher.add_pattern("AA", 0);
+    matcher.compile();
+
+    const std::vector<uint8_t> buffer(100, 0xAA);
+    size_t matches{};
+    matcher.scan(buffer.data(), buffer.data() + buffer.size(), [&](size_t, const uint8_t*) {
+        return ++matches == 3;
+    });
+    if (matches != 3)
+    {
+        std::printf("FAIL stop: the scan continued after the callback returned true\n");
+        return false;
+    }
+    std::printf("ok   stop\n");
+    return true;
+}
+
+static auto test_invalid_patterns() -> bool
+{
+    bool passed{true};
+    for (const auto pattern : {std::string_view{""}, std::string_view{"?? 48"}, std::string_view{"48 XY"}})
+    {
+        try
+        {
+            MultiPatternMatcher matcher{};
+            matcher.add_pattern(pattern, 0);
+            std::printf("FAIL invalid patterns: '%.*s' was accepted\n", static_cast<int>(pattern.size()), pattern.data());
+            passed = false;
+        }
+        catch (const std::runtime_error&)
+        {
+        }
+    }
+    if (passed)
+    {
+        std::printf("ok   invalid patterns\n");
+    }
+    return passed;
+}
+
+auto main() -> int
+{
+    for (const auto kernel : supported_kernels())
+    {
+        std::printf("Testing kernel %s\n", kernel_name(kernel));
+    }
+
+    bool passed{true};
+    passed &= test_wildcards();
+    passed &= test_overlapping_patterns();
+    passed &= test_region_boundaries();
+    passed &= test_random_buffers();
+    passed &= test_stop();
+    passed &= test_invalid_patterns();
+    return passed ? 0 : 1;
+}
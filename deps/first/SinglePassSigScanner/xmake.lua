@@ -1,5 +1,16 @@
 local projectName = "SinglePassSigScanner"
 
+-- The matcher only works on buffers and has no dependencies, so it builds on any OS
+target("MultiPatternMatcher")
+    set_kind("static")
+    set_languages("cxx23")
+    set_exceptions("cxx")
+
+    add_includedirs("include", { public = true })
+    add_defines("RC_SINGLE_PASS_SIG_SCANNER_BUILD_STATIC", { public = true })
+
+    add_files("src/MultiPatternMatcher.cpp")
+
 target(projectName)
     set_kind("static")
     set_languages("cxx23")
@@ -9,7 +20,7 @@ target(projectName)
     add_includedirs("include", { public = true })
     add_headerfiles("include/**.hpp")
 
-    add_files("src/**.cpp")
+    add_files("src/SinglePassSigScanner.cpp", "src/ScanResultCache.cpp")
     
-    add_deps("Profiler")
-    add_packages("fmt")
\ No newline at end of file
+    add_deps("Profiler", "MultiPatternMatcher")
+    add_packages("fmt")
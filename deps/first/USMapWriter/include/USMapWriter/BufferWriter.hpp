@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace RC::OutTheShade
+{
+    // Growable contiguous buffer, the written bytes can be handed to a compressor or a file without going through iostreams
+    class BufferWriter
+    {
+        std::vector<uint8_t> m_Buffer;
+        size_t m_Pos = 0;
+
+    public:
+
+        BufferWriter(size_t InitialCapacity = 0)
+        {
+            m_Buffer.reserve(InitialCapacity);
+        }
+
+        std::vector<uint8_t>& GetBuffer()
+        {
+            return m_Buffer;
+        }
+
+        const uint8_t* Data() const
+        {
+            return m_Buffer.data();
+        }
+
+        size_t Tell() const
+        {
+            return m_Pos;
+        }
+
+        void WriteString(std::string String)
+        {
+            Write(String.data(), String.size());
+        }
+
+        void WriteString(std::string_view String)
+        {
+            Write((void*)String.data(), String.size());
+        }
+
+        void Write(const void* Input, size_t Size)
+        {
+            auto Bytes = static_cast<const uint8_t*>(Input);
+            if (m_Pos == m_Buffer.size())
+            {
+                m_Buffer.insert(m_Buffer.end(), Bytes, Bytes + Size);
+            }
+            else
+            {
+                if (m_Pos + Size > m_Buffer.size())
+                {
+                    m_Buffer.resize(m_Pos + Size);
+                }
+                std::memcpy(m_Buffer.data() + m_Pos, Bytes, Size);
+            }
+            m_Pos += Size;
+        }
+
+        void Seek(int Pos, int Origin = SEEK_CUR)
+        {
+            switch (Origin)
+            {
+            case SEEK_SET:
+                m_Pos = Pos;
+                break;
+            case SEEK_END:
+                m_Pos = m_Buffer.size() + Pos;
+                break;
+            default:
+                m_Pos += Pos;
+                break;
+            }
+        }
+
+        uint32_t Size() const
+        {
+            return static_cast<uint32_t>(m_Buffer.size());
+        }
+
+        template <typename T>
+        void Write(T Input)
+        {
+            Write(&Input, sizeof(T));
+        }
+
+        // Overwrites a value that was written earlier, e.g. a size that wasn't known yet, without moving the write position
+        template <typename T>
+        void WriteAt(size_t Pos, T Input)
+        {
+            std::memcpy(m_Buffer.data() + Pos, &Input, sizeof(T));
+        }
+    };
+}
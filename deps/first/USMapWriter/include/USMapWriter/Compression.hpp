@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <USMapWriter/UsmapFile.hpp>
+
+namespace RC::OutTheShade
+{
+    // Returns false if 'Method' can't be written or compression failed, 'Output' is unspecified in that case
+    auto CompressUsmapData(EUsmapCompressionMethod Method, const std::vector<uint8_t>& Input, std::vector<uint8_t>& Output) -> bool;
+
+    // 'DecompressedSize' is the size stored in the .usmap header
+    // Returns false if 'Method' can't be read, the data is corrupt, or it doesn't decompress to exactly 'DecompressedSize' bytes
+    auto DecompressUsmapData(EUsmapCompressionMethod Method, const std::vector<uint8_t>& Input, size_t DecompressedSize, std::vector<uint8_t>& Output) -> bool;
+}
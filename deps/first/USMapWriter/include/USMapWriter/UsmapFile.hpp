@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace RC::OutTheShade
+{
+    enum class EUsmapVersion : uint8_t
+    {
+        Initial = 0,
+        PackageVersioning = 1,
+        LongFName = 2,
+        LargeEnums = 3,
+        ExplicitEnumValues = 4,
+
+        Latest = ExplicitEnumValues,
+        LatestPlusOne
+    };
+
+    // Values are written to the file as-is and must match the usmap format
+    enum class EUsmapCompressionMethod : uint8_t
+    {
+        None = 0,
+        Oodle = 1,
+        Brotli = 2,
+        ZStandard = 3,
+    };
+
+    constexpr uint16_t UsmapMagic = 0x30C4;
+
+    // magic, version, bHasVersionInfo, compression method, compressed size, decompressed size
+    constexpr size_t UsmapHeaderSize = sizeof(uint16_t) + sizeof(uint8_t) + sizeof(int32_t) + sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint32_t);
+
+    // Writes the header followed by 'Payload' compressed with 'Method' to 'Output', i.e. the whole contents of a .usmap file
+    // Falls back to no compression if 'Method' can't be written or compression failed
+    // Returns the method that was written to the header
+    auto WriteUsmapFile(EUsmapCompressionMethod Method, const std::vector<uint8_t>& Payload, std::vector<uint8_t>& Output) -> EUsmapCompressionMethod;
+}
@@ -0,0 +1,68 @@
+#include <brotli/decode.h>
+#include <brotli/encode.h>
+#include <zstd.h>
+
+#include <USMapWriter/Compression.hpp>
+
+namespace RC::OutTheShade
+{
+    // Slower levels than the defaults, mappings are generated rarely but loaded by tools all the time
+    constexpr static int ZStandardCompressionLevel = 19;
+    constexpr static int BrotliCompressionQuality = 9;
+
+    auto CompressUsmapData(EUsmapCompressionMethod Method, const std::vector<uint8_t>& Input, std::vector<uint8_t>& Output) -> bool
+    {
+        switch (Method)
+        {
+        case EUsmapCompressionMethod::ZStandard: {
+            Output.resize(ZSTD_compressBound(Input.size()));
+            const size_t CompressedSize = ZSTD_compress(Output.data(), Output.size(), Input.data(), Input.size(), ZStandardCompressionLevel);
+            if (ZSTD_isError(CompressedSize))
+            {
+                return false;
+            }
+            Output.resize(CompressedSize);
+            return true;
+        }
+        case EUsmapCompressionMethod::Brotli: {
+            size_t CompressedSize = BrotliEncoderMaxCompressedSize(Input.size());
+            Output.resize(CompressedSize);
+            if (CompressedSize == 0 ||
+                !BrotliEncoderCompress(BrotliCompressionQuality, BROTLI_DEFAULT_WINDOW, BROTLI_MODE_GENERIC, Input.size(), Input.data(), &CompressedSize, Output.data()))
+            {
+                return false;
+            }
+            Output.resize(CompressedSize);
+            return true;
+        }
+        default:
+            // Oodle isn't redistributable so it can't be written
+            return false;
+        }
+    }
+
+    auto DecompressUsmapData(EUsmapCompressionMethod Method, const std::vector<uint8_t>& Input, size_t DecompressedSize, std::vector<uint8_t>& Output) -> bool
+    {
+        Output.resize(DecompressedSize);
+        switch (Method)
+        {
+        case EUsmapCompressionMethod::None:
+            if (Input.size() != DecompressedSize)
+            {
+                return false;
+            }
+            Output = Input;
+            return true;
+        case EUsmapCompressionMethod::ZStandard: {
+            const size_t Size = ZSTD_decompress(Output.data(), Output.size(), Input.data(), Input.size());
+            return !ZSTD_isError(Size) && Size == DecompressedSize;
+        }
+        case EUsmapCompressionMethod::Brotli: {
+            size_t Size = Output.size();
+            return BrotliDecoderDecompress(Input.size(), Input.data(), &Size, Output.data()) == BROTLI_DECODER_RESULT_SUCCESS && Size == DecompressedSize;
+        }
+        default:
+            return false;
+        }
+    }
+}
@@ -0,0 +1,31 @@
+#include <utility>
+
+#include <USMapWriter/BufferWriter.hpp>
+#include <USMapWriter/Compression.hpp>
+#include <USMapWriter/UsmapFile.hpp>
+
+namespace RC::OutTheShade
+{
+    auto WriteUsmapFile(EUsmapCompressionMethod Method, const std::vector<uint8_t>& Payload, std::vector<uint8_t>& Output) -> EUsmapCompressionMethod
+    {
+        std::vector<uint8_t> CompressedData;
+        if (Method != EUsmapCompressionMethod::None && !CompressUsmapData(Method, Payload, CompressedData))
+        {
+            Method = EUsmapCompressionMethod::None;
+        }
+        const auto& UsmapData = Method == EUsmapCompressionMethod::None ? Payload : CompressedData;
+
+        BufferWriter File(UsmapHeaderSize + UsmapData.size());
+        File.Write<uint16_t>(UsmapMagic);                                    // magic
+        File.Write<uint8_t>(static_cast<uint8_t>(EUsmapVersion::Latest));    // version
+        File.Write<int32_t>(0);                                              // bHasVersionInfo (false, no UE4/UE5 version info)
+        File.Write<uint8_t>(static_cast<uint8_t>(Method));                   // compression
+        // Warning: Converting size_t (uint64) to uint32_t.
+        File.Write<uint32_t>(static_cast<uint32_t>(UsmapData.size()));      // compressed size
+        File.Write<uint32_t>(static_cast<uint32_t>(Payload.size()));         // decompressed size
+        File.Write(UsmapData.data(), UsmapData.size());
+
+        Output = std::move(File.GetBuffer());
+        return Method;
+    }
+}
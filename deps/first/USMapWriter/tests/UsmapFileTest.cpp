@@ -0,0 +1,244 @@
+// Writes small .usmap files with every compression method that UE4SS can write, and reads them back without going through the writer.
+// Built when UE4SS_USMapWriter_BUILD_TESTS is on (the default when this directory is configured on its own), and run with ctest.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <brotli/decode.h>
+#include <zstd.h>
+
+#include <USMapWriter/BufferWriter.hpp>
+#include <USMapWriter/Compression.hpp>
+#include <USMapWriter/UsmapFile.hpp>
+
+using namespace RC::OutTheShade;
+
+// The usmap format fixes the header layout, the reader below depends on it
+static_assert(UsmapHeaderSize == 16);
+
+// Roughly what a mappings payload looks like: a name table followed by small integers
+static auto make_payload(size_t size) -> std::vector<uint8_t>
+{
+    constexpr std::string_view names[] = {"RootComponent", "bHidden", "PrimaryActorTick", "Instigator", "Owner", "CustomTimeDilation", "Tags"};
+    std::mt19937 rng{42};
+    std::vector<uint8_t> payload{};
+    while (payload.size() < size)
+    {
+        const auto name = names[std::uniform_int_distribution<size_t>{0, std::size(names) - 1}(rng)];
+        payload.emplace_back(static_cast<uint8_t>(name.size()));
+        payload.insert(payload.end(), name.begin(), name.end());
+        for (int i = 0; i < 8; ++i)
+        {
+            payload.emplace_back(static_cast<uint8_t>(std::uniform_int_distribution<int>{0, 40}(rng)));
+        }
+    }
+    payload.resize(size);
+    return payload;
+}
+
+static auto round_trip(EUsmapCompressionMethod method, const char* method_name, const std::vector<uint8_t>& payload) -> bool
+{
+    std::vector<uint8_t> compressed{};
+    if (method == EUsmapCompressionMethod::None)
+    {
+        compressed = payload;
+    }
+    else if (!CompressUsmapData(method, payload, compressed))
+    {
+        std::printf("FAIL %s: compressing %zu bytes failed\n", method_name, payload.size());
+        return false;
+    }
+
+    std::vector<uint8_t> decompressed{};
+    if (!DecompressUsmapData(method, compressed, payload.size(), decompressed) || decompressed != payload)
+    {
+        std::printf("FAIL %s: %zu bytes didn't decompress to the original data\n", method_name, payload.size());
+        return false;
+    }
+
+    // The size in the header must be checked, a truncated file must not load
+    if (!payload.empty() && DecompressUsmapData(method, compressed, payload.size() + 1, decompressed))
+    {
+        std::printf("FAIL %s: decompressing to the wrong size succeeded\n", method_name);
+        return false;
+    }
+
+    std::printf("ok   %s: %zu -> %zu bytes\n", method_name, payload.size(), compressed.size());
+    return true;
+}
+
+constexpr std::string_view usmap_names[] = {"Actor", "RootComponent", "EMyEnum", "EMyEnum::First", "EMyEnum::Second"};
+
+// A tiny but complete mappings payload laid out the way generate_usmap writes it: names, one enum, no structs
+static auto make_usmap_payload() -> std::vector<uint8_t>
+{
+    BufferWriter buffer{};
+    buffer.Write<int>(static_cast<int>(std::size(usmap_names)));
+    for (const auto name : usmap_names)
+    {
+        buffer.Write<uint16_t>(static_cast<uint16_t>(name.size()));
+        buffer.WriteString(name);
+    }
+
+    buffer.Write<uint32_t>(1);
+    buffer.Write<int32_t>(2);
+    buffer.Write<uint16_t>(2);
+    buffer.Write<int64_t>(0);
+    buffer.Write<int32_t>(3);
+    buffer.Write<int64_t>(5);
+    buffer.Write<int32_t>(4);
+
+    buffer.Write<uint32_t>(0);
+    return buffer.GetBuffer();
+}
+
+struct UsmapHeader
+{
+    uint16_t magic{};
+    uint8_t version{};
+    int32_t has_version_info{};
+    uint8_t method{};
+    uint32_t compressed_size{};
+    uint32_t decompressed_size{};
+};
+
+template <typename T>
+static auto read(const std::vector<uint8_t>& file, size_t& pos) -> T
+{
+    T value{};
+    std::memcpy(&value, file.data() + pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+}
+
+// Decompresses with the libraries directly so a bug shared by the writer and DecompressUsmapData can't hide itself
+static auto decompress(uint8_t method, const uint8_t* data, size_t size, size_t decompressed_size, std::vector<uint8_t>& out) -> bool
+{
+    out.resize(decompressed_size);
+    switch (static_cast<EUsmapCompressionMethod>(method))
+    {
+    case EUsmapCompressionMethod::None:
+        out.assign(data, data + size);
+        return size == decompressed_size;
+    case EUsmapCompressionMethod::ZStandard: {
+        const size_t result = ZSTD_decompress(out.data(), out.size(), data, size);
+        return !ZSTD_isError(result) && result == decompressed_size;
+    }
+    case EUsmapCompressionMethod::Brotli: {
+        size_t result = out.size();
+        return BrotliDecoderDecompress(size, data, &result, out.data()) == BROTLI_DECODER_RESULT_SUCCESS && result == decompressed_size;
+    }
+    default:
+        return false;
+    }
+}
+
+static auto write_and_read_back(EUsmapCompressionMethod method, const char* method_name, EUsmapCompressionMethod expected_method) -> bool
+{
+    const auto payload = make_usmap_payload();
+    std::vector<uint8_t> file{};
+    const auto written_method = WriteUsmapFile(method, payload, file);
+    if (written_method != expected_method)
+    {
+        std::printf("FAIL file %s: wrote method %u, expected %u\n", method_name, static_cast<unsigned>(written_method), static_cast<unsigned>(expected_method));
+        return false;
+    }
+
+    if (file.size() < UsmapHeaderSize)
+    {
+        std::printf("FAIL file %s: %zu bytes is too small for the header\n", method_name, file.size());
+        return false;
+    }
+
+    size_t pos{};
+    UsmapHeader header{};
+    header.magic = read<uint16_t>(file, pos);
+    header.version = read<uint8_t>(file, pos);
+    header.has_version_info = read<int32_t>(file, pos);
+    header.method = read<uint8_t>(file, pos);
+    header.compressed_size = read<uint32_t>(file, pos);
+    header.decompressed_size = read<uint32_t>(file, pos);
+
+    if (header.magic != 0x30C4 || header.version != static_cast<uint8_t>(EUsmapVersion::Latest) || header.has_version_info != 0 ||
+        header.method != static_cast<uint8_t>(expected_method))
+    {
+        std::printf("FAIL file %s: bad header, magic 0x%X version %u version info %d method %u\n",
+                    method_name,
+                    header.magic,
+                    header.version,
+                    header.has_version_info,
+                    header.method);
+        return false;
+    }
+
+    if (header.compressed_size != file.size() - pos || header.decompressed_size != payload.size())
+    {
+        std::printf("FAIL file %s: header sizes %u/%u don't match %zu bytes of data and a %zu byte payload\n",
+                    method_name,
+                    header.compressed_size,
+                    header.decompressed_size,
+                    file.size() - pos,
+                    payload.size());
+        return false;
+    }
+
+    std::vector<uint8_t> decompressed{};
+    if (!decompress(header.method, file.data() + pos, header.compressed_size, header.decompressed_size, decompressed) || decompressed != payload)
+    {
+        std::printf("FAIL file %s: the data didn't decompress to the payload\n", method_name);
+        return false;
+    }
+
+    // Walk the name map to make sure the payload survived as a mappings file, not just as bytes
+    size_t payload_pos{};
+    if (read<int>(decompressed, payload_pos) != static_cast<int>(std::size(usmap_names)))
+    {
+        std::printf("FAIL file %s: wrong name count\n", method_name);
+        return false;
+    }
+    for (const auto name : usmap_names)
+    {
+        const auto length = read<uint16_t>(decompressed, payload_pos);
+        if (std::string_view{reinterpret_cast<const char*>(decompressed.data() + payload_pos), length} != name)
+        {
+            std::printf("FAIL file %s: name '%.*s' didn't survive\n", method_name, static_cast<int>(name.size()), name.data());
+            return false;
+        }
+        payload_pos += length;
+    }
+
+    std::printf("ok   file %s: %zu byte payload -> %zu byte file\n", method_name, payload.size(), file.size());
+    return true;
+}
+
+auto main() -> int
+{
+    bool passed{true};
+    passed &= write_and_read_back(EUsmapCompressionMethod::None, "None", EUsmapCompressionMethod::None);
+    passed &= write_and_read_back(EUsmapCompressionMethod::Brotli, "Brotli", EUsmapCompressionMethod::Brotli);
+    passed &= write_and_read_back(EUsmapCompressionMethod::ZStandard, "ZStandard", EUsmapCompressionMethod::ZStandard);
+    // Oodle can't be written so the file must fall back to being uncompressed, not claim Oodle in the header
+    passed &= write_and_read_back(EUsmapCompressionMethod::Oodle, "Oodle", EUsmapCompressionMethod::None);
+
+    for (const size_t size : {size_t{0}, size_t{1}, size_t{4096}, size_t{8 * 1024 * 1024}})
+    {
+        const auto payload = make_payload(size);
+        passed &= round_trip(EUsmapCompressionMethod::None, "None", payload);
+        passed &= round_trip(EUsmapCompressionMethod::Brotli, "Brotli", payload);
+        passed &= round_trip(EUsmapCompressionMethod::ZStandard, "ZStandard", payload);
+    }
+
+    std::vector<uint8_t> output{};
+    if (CompressUsmapData(EUsmapCompressionMethod::Oodle, make_payload(16), output))
+    {
+        std::printf("FAIL Oodle: compressing should not be supported\n");
+        passed = false;
+    }
+
+    return passed ? 0 : 1;
+}
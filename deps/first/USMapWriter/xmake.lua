@@ -0,0 +1,15 @@
+local projectName = "USMapWriter"
+
+-- Only the buffer, compression & file header code, it doesn't touch Unreal so it builds on any OS
+target(projectName)
+    set_kind("static")
+    set_languages("cxx23")
+    set_exceptions("cxx")
+    add_rules("ue4ss.dependency")
+
+    add_includedirs("include", { public = true })
+    add_headerfiles("include/**.hpp")
+
+    add_files("src/**.cpp")
+
+    add_packages("zstd", "brotli")
@@ -19,6 +19,7 @@ includes("Profiler")
 includes("ScopedTimer")
 includes("SinglePassSigScanner")
 includes("Unreal")
+includes("USMapWriter")
 includes("String")
 
 task("manuallyBuildLocalPatternsleuth")